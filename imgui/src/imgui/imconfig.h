@@ -42,6 +42,15 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
+//#define IMGUI_DISABLE_SSE                                 // Don't use SSE2 intrinsics (e.g. in ImFont::RenderText()) even when the compiler targets them.
+
+//---- Implement ImGuiStorage as an open addressing hash table instead of a sorted vector: O(1) queries and insertions, for very large numbers of ids (e.g. per-row state of big tables).
+// Code iterating ImGuiStorage::Data directly needs to skip free slots with ImGuiStorage::IsPairValid().
+//#define IMGUI_STORAGE_USE_HASH_MAP
+
+//---- Hash ids with CRC32C instead of CRC32, so the SSE4.2 'crc32' instruction can be used when the CPU supports it (checked at runtime, results are the same either way).
+// Ids differ from the default build, so ids saved by it (e.g. table settings in .ini files) won't be found.
+//#define IMGUI_USE_CRC32C
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -81,12 +90,32 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact ImDrawVert layout to reduce vertex bandwidth (default is 20 bytes: float pos, float uv, ImU32 col). Both together give a 12 bytes vertex.
+// Your renderer back-end will need to support it (imgui_impl_opengl3 and imgui_impl_softraster do). See ImDrawVert in imgui.h for the ranges.
+//#define IMGUI_DRAWVERT_POS_FIXED16        // 16-bit fixed point positions, 1/8 pixel precision (see IMGUI_DRAWVERT_POS_FRAC_BITS)
+//#define IMGUI_DRAWVERT_UV_UNORM16         // 16-bit normalized texture coordinates, in the 0..1 range only
+
+//---- Don't skip ImDrawList primitives entirely outside of the current clipping rectangle before generating their geometry.
+// Tables, which enlarge the clipping rectangle of their column draw calls when merging them, already cull against their host clipping rectangle.
+// Only needed if your own code enlarges ImDrawCmd::ClipRect after drawing into a command.
+//#define IMGUI_DISABLE_DRAWLIST_CULLING
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
 //typedef void (*MyImDrawCallback)(const ImDrawList* draw_list, const ImDrawCmd* cmd, void* my_renderer_user_data);
 //#define ImDrawCallback MyImDrawCallback
 
+//---- Use a thread-local current context, so worker threads can record windows into their own context (see ImGui::CreateWorkerContext()).
+// You need to define MyImGuiTLS in one of your own .cpp files.
+//struct ImGuiContext;
+//extern thread_local ImGuiContext* MyImGuiTLS;
+//#define GImGui MyImGuiTLS
+
+//---- Count bytes, allocations and peak usage per ImGuiMemTag in MemAlloc()/MemFree(), see ImGui::GetMemStats() and the Memory section of the Metrics window.
+// This adds a 16 bytes header to every allocation: memory whose ownership is given to imgui (e.g. AddFontFromMemoryTTF() data) must then come from IM_ALLOC().
+//#define IMGUI_ENABLE_MEMORY_STATS
+
 //---- Debug Tools: Macro to break in Debugger
 // (use 'Metrics->Tools->Item Picker' to pick widgets with the mouse and break into them for easy debugging.)
 //#define IM_DEBUG_BREAK  IM_ASSERT(0)
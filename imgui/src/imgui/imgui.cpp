@@ -63,6 +63,7 @@ CODE
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
 // [SECTION] ImGuiListClipper
+// [SECTION] ImGuiVariableListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] MAIN CODE (most of the code! lots of stuff, needs tidying up!)
@@ -727,6 +728,9 @@ CODE
 // System includes
 #include <ctype.h>      // toupper
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+#include <atomic>       // std::atomic (memory statistics)
+#endif
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -912,6 +916,49 @@ static void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWra
 static void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
 static void*    GImAllocatorUserData = NULL;
 
+// Memory statistics per ImGuiMemTag, shared by all contexts and updated from any thread (e.g. worker contexts). The last entry holds the totals.
+// Each allocation is prefixed with a header recording its size and tag, so MemFree() knows what to subtract.
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+struct ImGuiMemStatsCounters
+{
+    std::atomic<ImS64>  Bytes;
+    std::atomic<ImS64>  PeakBytes;
+    std::atomic<int>    Allocations;
+    std::atomic<int>    TotalAllocations;
+};
+struct ImGuiMemStatsHeader
+{
+    size_t              Size;
+    ImGuiMemTag         Tag;
+};
+#define IM_MEMSTATS_HEADER_SIZE     16  // Keep the 16 bytes alignment of the allocator
+IM_STATIC_ASSERT(sizeof(ImGuiMemStatsHeader) <= IM_MEMSTATS_HEADER_SIZE);
+static ImGuiMemStatsCounters GImMemStatsCounters[ImGuiMemTag_COUNT + 1];
+
+static void MemStatsAddTo(ImGuiMemStatsCounters& counters, ImS64 size)
+{
+    const ImS64 bytes = (counters.Bytes += size);
+    ImS64 peak_bytes = counters.PeakBytes.load(std::memory_order_relaxed);
+    while (bytes > peak_bytes && !counters.PeakBytes.compare_exchange_weak(peak_bytes, bytes, std::memory_order_relaxed)) {}
+    counters.Allocations++;
+    counters.TotalAllocations++;
+}
+
+static void MemStatsAdd(ImGuiMemTag tag, ImS64 size)
+{
+    MemStatsAddTo(GImMemStatsCounters[tag], size);
+    MemStatsAddTo(GImMemStatsCounters[ImGuiMemTag_COUNT], size);
+}
+
+static void MemStatsSub(ImGuiMemTag tag, ImS64 size)
+{
+    GImMemStatsCounters[tag].Bytes -= size;
+    GImMemStatsCounters[tag].Allocations--;
+    GImMemStatsCounters[ImGuiMemTag_COUNT].Bytes -= size;
+    GImMemStatsCounters[ImGuiMemTag_COUNT].Allocations--;
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1349,6 +1396,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -1367,26 +1424,217 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+// Write the decimal digits of 'v' ending at 'p_end' (exclusive), two at a time. Return the first digit.
+static const char GDigitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869"
+    "707172737475767778798081828384858687888990919293949596979899";
+static char* ImFormatUIntBackwards(char* p_end, ImU64 v)
+{
+    char* p = p_end;
+    while (v >= 100)
+    {
+        const int i = (int)(v % 100) * 2;
+        v /= 100;
+        p -= 2;
+        p[0] = GDigitPairs[i];
+        p[1] = GDigitPairs[i + 1];
+    }
+    if (v >= 10)
+    {
+        const int i = (int)v * 2;
+        p -= 2;
+        p[0] = GDigitPairs[i];
+        p[1] = GDigitPairs[i + 1];
+    }
+    else
+    {
+        *--p = (char)('0' + v);
+    }
+    return p;
+}
+
+// Write 'v' with 'precision' decimals ending at 'p_end' (exclusive), rounding the value scaled to an integer. Return the first character.
+// Return NULL when the result may differ from printf(), which rounds the exact binary value: non-finite or large values,
+// and values so close to a rounding tie that the error of the scaling multiplication could matter.
+static char* ImFormatFixedBackwards(char* p_end, double v, int precision, bool* out_negative)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+    if (precision >= IM_ARRAYSIZE(pow10))
+        return NULL;
+    *out_negative = (v < 0.0 || (v == 0.0 && 1.0 / v < 0.0)); // printf() also prints the sign of -0.0
+    const double scaled = (v < 0.0 ? -v : v) * pow10[precision];
+    if (!(scaled < 4503599627370496.0)) // 2^52, also rejects NaN and infinities
+        return NULL;
+    ImU64 n = (ImU64)scaled;
+    const double frac = scaled - (double)n;
+    if (frac - 0.5 <= scaled * 2.3e-16 && 0.5 - frac <= scaled * 2.3e-16)
+        return NULL;
+    if (frac > 0.5)
+        n++;
+
+    char* p = p_end;
+    if (precision > 0)
+    {
+        const ImU64 div = (ImU64)pow10[precision];
+        char* frac_end = p;
+        p = ImFormatUIntBackwards(p, n % div);
+        while (frac_end - p < precision)
+            *--p = '0';
+        *--p = '.';
+        n /= div;
+    }
+    return ImFormatUIntBackwards(p, n);
+}
+
+// Fast path of ImFormatStringV() for the formats most used by Text() and widgets: literal text with %d %i %u (optional '0' flag and width),
+// %f (optional '0' flag, width and precision), %s (optional precision) and %%. Width and precision may be given as '*'.
+// Return -1 when anything needs the complete vsnprintf() (stbsp_vsnprintf() with IMGUI_USE_STB_SPRINTF): other conversions, flags or length modifiers,
+// values printf() could round differently, or an output not fitting in the buffer. 'args' is left partially consumed in that case, so pass a copy.
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    char* out = buf;
+    char* const out_end = buf + buf_size - 1; // Keep room for zero-terminator
+    while (*fmt)
+    {
+        if (*fmt != '%' || fmt[1] == '%')
+        {
+            if (out == out_end)
+                return -1;
+            *out++ = *fmt;
+            fmt += (*fmt == '%') ? 2 : 1;
+            continue;
+        }
+        fmt++;
+
+        // Parse flag, width and precision
+        const bool zero_pad = (*fmt == '0');
+        if (zero_pad)
+            fmt++;
+        int width = 0, precision = -1;
+        if (*fmt == '*')
+        {
+            width = va_arg(args, int);
+            fmt++;
+        }
+        else
+        {
+            while (*fmt >= '0' && *fmt <= '9' && width < 10000)
+                width = width * 10 + (*fmt++ - '0');
+        }
+        if (*fmt == '.')
+        {
+            fmt++;
+            precision = 0;
+            if (*fmt == '*')
+            {
+                precision = va_arg(args, int);
+                fmt++;
+            }
+            else
+            {
+                while (*fmt >= '0' && *fmt <= '9' && precision < 10000)
+                    precision = precision * 10 + (*fmt++ - '0');
+            }
+        }
+        if (width < 0 || width >= 10000 || precision >= 10000) // Negative width is the '-' flag
+            return -1;
+
+        // Convert into 'tmp', or point to the string argument
+        char tmp[32];
+        const char* s = NULL;
+        const char* s_end = tmp + IM_ARRAYSIZE(tmp);
+        bool negative = false;
+        switch (*fmt++)
+        {
+        case 'd':
+        case 'i':
+        {
+            const int v = va_arg(args, int);
+            if (precision >= 0)
+                return -1;
+            negative = (v < 0);
+            s = ImFormatUIntBackwards(tmp + IM_ARRAYSIZE(tmp), negative ? (ImU64)(-(ImS64)v) : (ImU64)v);
+            break;
+        }
+        case 'u':
+        {
+            const unsigned int v = va_arg(args, unsigned int);
+            if (precision >= 0)
+                return -1;
+            s = ImFormatUIntBackwards(tmp + IM_ARRAYSIZE(tmp), (ImU64)v);
+            break;
+        }
+        case 'f':
+        {
+            const double v = va_arg(args, double);
+            s = ImFormatFixedBackwards(tmp + IM_ARRAYSIZE(tmp), v, (precision < 0) ? 6 : precision, &negative);
+            if (s == NULL)
+                return -1;
+            break;
+        }
+        case 's':
+        {
+            s = va_arg(args, const char*);
+            if (s == NULL || zero_pad)
+                return -1;
+            s_end = s;
+            if (precision >= 0)
+                while (s_end - s < precision && *s_end)
+                    s_end++;
+            else
+                s_end = s + strlen(s);
+            break;
+        }
+        default:
+            return -1;
+        }
+
+        // Pad to width: zeros go after the sign, spaces before it
+        const int len = (int)(s_end - s) + (negative ? 1 : 0);
+        const int pad = (width > len) ? width - len : 0;
+        if (out_end - out < len + pad)
+            return -1;
+        if (pad > 0 && !zero_pad)
+        {
+            memset(out, ' ', (size_t)pad);
+            out += pad;
+        }
+        if (negative)
+            *out++ = '-';
+        if (pad > 0 && zero_pad)
+        {
+            memset(out, '0', (size_t)pad);
+            out += pad;
+        }
+        memcpy(out, s, (size_t)(s_end - s));
+        out += s_end - s;
+    }
+    *out = 0;
+    return (int)(out - buf);
+}
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
     return w;
 }
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
+    // Skip vsnprintf() and its locale handling for common formats
+    if (buf != NULL && buf_size > 0)
+    {
+        va_list args_copy;
+        va_copy(args_copy, args);
+        int w = ImFormatStringFastV(buf, buf_size, fmt, args_copy);
+        va_end(args_copy);
+        if (w >= 0)
+            return w;
+    }
+
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
@@ -1404,6 +1652,7 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+#ifndef IMGUI_USE_CRC32C
 static const ImU32 GCrc32LookupTable[256] =
 {
     0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
@@ -1423,6 +1672,103 @@ static const ImU32 GCrc32LookupTable[256] =
     0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
+#else
+// CRC32C (Castagnoli polynomial), which is what the SSE4.2 'crc32' instruction computes. The table is used when the CPU doesn't have it.
+static const ImU32 GCrc32LookupTable[256] =
+{
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+};
+#endif
+
+// With IMGUI_USE_CRC32C, use the SSE4.2 'crc32' instruction when available.
+// Unless the compiler already targets SSE4.2, the instruction is compiled for a single function and selected at runtime.
+#if defined(IMGUI_USE_CRC32C) && defined(IMGUI_ENABLE_SSE) && (defined(__SSE4_2__) || defined(_MSC_VER) || defined(__GNUC__))
+#define IMGUI_ENABLE_SSE42_CRC32
+#include <nmmintrin.h>      // _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+#if defined(__SSE4_2__)
+#define IM_SSE42_TARGET
+static inline bool ImCpuHasSse42() { return true; }
+#else
+#if defined(_MSC_VER)
+#include <intrin.h>         // __cpuid
+#define IM_SSE42_TARGET
+static bool ImCpuDetectSse42() { int info[4]; __cpuid(info, 1); return (info[2] & (1 << 20)) != 0; }
+#else
+#define IM_SSE42_TARGET     __attribute__((target("sse4.2")))
+static bool ImCpuDetectSse42() { __builtin_cpu_init(); return __builtin_cpu_supports("sse4.2") != 0; } // __builtin_cpu_init() is needed if we are called from a static constructor
+#endif
+static bool ImCpuHasSse42() { static const bool has_sse42 = ImCpuDetectSse42(); return has_sse42; }
+#endif
+
+IM_SSE42_TARGET static inline ImU32 ImCrc32cU64(ImU32 crc, ImU64 v)
+{
+#if defined(_M_X64) || defined(__x86_64__)
+    return (ImU32)_mm_crc32_u64(crc, v);
+#else
+    return _mm_crc32_u32(_mm_crc32_u32(crc, (ImU32)v), (ImU32)(v >> 32));
+#endif
+}
+
+IM_SSE42_TARGET static ImU32 ImHashDataSse42(const unsigned char* data, size_t data_size, ImU32 crc)
+{
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = ImCrc32cU64(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return crc;
+}
+
+// Same as the ImHashStr() loop below. Blocks of 8 bytes without any '#' are hashed at once, others one byte at a time.
+IM_SSE42_TARGET static ImU32 ImHashStrSse42(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = seed;
+    while (data_size != 0)
+    {
+        if (data_size >= 8)
+        {
+            ImU64 v;
+            memcpy(&v, data, 8);
+            const ImU64 x = v ^ 0x2323232323232323ULL; // Zero bytes where v has '#'
+            if (((x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL) == 0)
+            {
+                crc = ImCrc32cU64(crc, v);
+                data += 8;
+                data_size -= 8;
+                continue;
+            }
+        }
+        const size_t block_end = (data_size >= 8) ? data_size - 8 : 0;
+        while (data_size-- != block_end)
+        {
+            unsigned char c = *data++;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = _mm_crc32_u8(crc, c);
+        }
+        data_size = block_end;
+    }
+    return crc;
+}
+#endif // #ifdef IMGUI_ENABLE_SSE42_CRC32
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
@@ -1431,6 +1777,10 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_SSE42_CRC32
+    if (ImCpuHasSse42())
+        return ~ImHashDataSse42(data, data_size, crc);
+#endif
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
@@ -1448,6 +1798,10 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_SSE42_CRC32
+    if (ImCpuHasSse42())
+        return ~ImHashStrSse42(data, data_size ? data_size : strlen(data_p), seed);
+#endif
     const ImU32* crc32_lut = GCrc32LookupTable;
     if (data_size != 0)
     {
@@ -1815,6 +2169,8 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifndef IMGUI_STORAGE_USE_HASH_MAP
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
 {
@@ -1838,6 +2194,13 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Insertions are the only place where the sorted storage allocates
+static ImGuiStorage::ImGuiStoragePair* StorageInsert(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiStorage::ImGuiStoragePair* it, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    return data.insert(it, pair);
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1889,7 +2252,7 @@ int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+        it = StorageInsert(Data, it, ImGuiStoragePair(key, default_val));
     return &it->val_i;
 }
 
@@ -1902,7 +2265,7 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+        it = StorageInsert(Data, it, ImGuiStoragePair(key, default_val));
     return &it->val_f;
 }
 
@@ -1910,7 +2273,7 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+        it = StorageInsert(Data, it, ImGuiStoragePair(key, default_val));
     return &it->val_p;
 }
 
@@ -1920,7 +2283,7 @@ void ImGuiStorage::SetInt(ImGuiID key, int val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
-        Data.insert(it, ImGuiStoragePair(key, val));
+        StorageInsert(Data, it, ImGuiStoragePair(key, val));
         return;
     }
     it->val_i = val;
@@ -1936,7 +2299,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
-        Data.insert(it, ImGuiStoragePair(key, val));
+        StorageInsert(Data, it, ImGuiStoragePair(key, val));
         return;
     }
     it->val_f = val;
@@ -1947,7 +2310,7 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
-        Data.insert(it, ImGuiStoragePair(key, val));
+        StorageInsert(Data, it, ImGuiStoragePair(key, val));
         return;
     }
     it->val_p = val;
@@ -1959,6 +2322,195 @@ void ImGuiStorage::SetAllInt(int v)
         Data[i].val_i = v;
 }
 
+#else // #ifndef IMGUI_STORAGE_USE_HASH_MAP
+
+// Open addressing with linear probing, grown at 3/4 load. Pairs are never removed, so there are no tombstones.
+// Keys are mixed before masking: most are hashes already, but user keys may be small sequential or strided integers.
+static inline int StorageSlot(ImGuiID key, int mask)
+{
+    key *= 0x9E3779B1u;
+    return (int)(key ^ (key >> 15)) & mask;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    const ImVector<ImGuiStorage::ImGuiStoragePair>& data = storage->Data;
+    if (key == 0)
+        return storage->HasZeroKey ? &data.Data[data.Size - 1] : NULL;
+    if (data.Size == 0)
+        return NULL;
+    const int mask = data.Size - 2;
+    for (int i = StorageSlot(key, mask); data.Data[i].key != 0; i = (i + 1) & mask)
+        if (data.Data[i].key == key)
+            return &data.Data[i];
+    return NULL;
+}
+
+static void StorageGrow(ImGuiStorage* storage)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    ImVector<ImGuiStorage::ImGuiStoragePair> old_data;
+    old_data.swap(storage->Data);
+    const int old_capacity = (old_data.Size > 0) ? old_data.Size - 1 : 0;
+    const int new_capacity = (old_capacity > 0) ? old_capacity * 2 : 16;
+    const int mask = new_capacity - 1;
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = storage->Data;
+    data.resize(new_capacity + 1, ImGuiStorage::ImGuiStoragePair(0, (void*)NULL));
+    storage->Capacity = new_capacity;
+    for (int n = 0; n < old_capacity; n++)
+    {
+        if (old_data.Data[n].key == 0)
+            continue;
+        int i = StorageSlot(old_data.Data[n].key, mask);
+        while (data.Data[i].key != 0)
+            i = (i + 1) & mask;
+        data.Data[i] = old_data.Data[n];
+    }
+    if (old_data.Size > 0)
+        data.Data[new_capacity] = old_data.Data[old_capacity];
+}
+
+// Find pair or insert it with a zero value. Sets 'inserted' so the caller can write its default value.
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, ImGuiID key, bool* inserted)
+{
+    ImGuiStorage::ImGuiStoragePair* it = StorageFind(storage, key);
+    *inserted = (it == NULL);
+    if (it != NULL)
+        return it;
+    if (storage->Data.Size == 0 || (key != 0 && (storage->Count + 1) * 4 > (storage->Data.Size - 1) * 3))
+        StorageGrow(storage);
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = storage->Data;
+    if (key == 0)
+    {
+        storage->HasZeroKey = true;
+        it = &data.Data[data.Size - 1];
+    }
+    else
+    {
+        const int mask = data.Size - 2;
+        int i = StorageSlot(key, mask);
+        while (data.Data[i].key != 0)
+            i = (i + 1) & mask;
+        storage->Count++;
+        it = &data.Data[i];
+    }
+    *it = ImGuiStorage::ImGuiStoragePair(key, (void*)NULL);
+    return it;
+}
+
+// Pairs pushed past the table (all of Data when there is no table yet) are moved out and inserted into the table
+void ImGuiStorage::BuildSortByKey()
+{
+    const int table_size = (Capacity > 0) ? Capacity + 1 : 0;
+    if (Data.Size == table_size)
+        return;
+    ImVector<ImGuiStoragePair> pairs;
+    if (table_size == 0)
+    {
+        pairs.swap(Data);
+    }
+    else
+    {
+        pairs.reserve(Data.Size - table_size);
+        for (int n = table_size; n < Data.Size; n++)
+            pairs.push_back(Data[n]);
+        Data.resize(table_size);
+    }
+    for (int n = 0; n < pairs.Size; n++)
+    {
+        bool inserted;
+        *StorageFindOrInsert(this, pairs[n].key, &inserted) = pairs[n];
+    }
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    bool inserted;
+    ImGuiStoragePair* it = StorageFindOrInsert(this, key, &inserted);
+    if (inserted)
+        it->val_i = default_val;
+    return &it->val_i;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    bool inserted;
+    ImGuiStoragePair* it = StorageFindOrInsert(this, key, &inserted);
+    if (inserted)
+        it->val_f = default_val;
+    return &it->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    bool inserted;
+    ImGuiStoragePair* it = StorageFindOrInsert(this, key, &inserted);
+    if (inserted)
+        it->val_p = default_val;
+    return &it->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    bool inserted;
+    StorageFindOrInsert(this, key, &inserted)->val_i = val;
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    bool inserted;
+    StorageFindOrInsert(this, key, &inserted)->val_f = val;
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    bool inserted;
+    StorageFindOrInsert(this, key, &inserted)->val_p = val;
+}
+
+void ImGuiStorage::SetAllInt(int v)
+{
+    for (int i = 0; i < Data.Size; i++)
+        if (IsPairValid(i))
+            Data[i].val_i = v;
+}
+
+#endif // #ifndef IMGUI_STORAGE_USE_HASH_MAP
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextFilter
 //-----------------------------------------------------------------------------
@@ -2065,16 +2617,6 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 // [SECTION] ImGuiTextBuffer
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -2144,6 +2686,18 @@ static bool GetSkipItemForListClipping()
     return (g.CurrentTable ? g.CurrentTable->HostSkipItems : g.CurrentWindow->SkipItems);
 }
 
+// We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
+static ImRect GetListClippingRect(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRect);
+    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
+        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
+    return unclipped_rect;
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -2164,13 +2718,7 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
         return;
     }
 
-    // We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
-    ImRect unclipped_rect = window->ClipRect;
-    if (g.NavMoveRequest)
-        unclipped_rect.Add(g.NavScoringRect);
-    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
-        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
-
+    const ImRect unclipped_rect = GetListClippingRect(window);
     const ImVec2 pos = window->DC.CursorPos;
     int start = (int)((unclipped_rect.Min.y - pos.y) / items_height);
     int end = (int)((unclipped_rect.Max.y - pos.y) / items_height);
@@ -2187,7 +2735,8 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
     *out_items_display_end = end;
 }
 
-static void SetCursorPosYAndSetupForPrevLine(float pos_y, float line_height)
+// 'items_skipped' is inferred from 'line_height' when not specified, which is only right for evenly sized items.
+static void SetCursorPosYAndSetupForPrevLine(float pos_y, float line_height, int items_skipped = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -2206,7 +2755,7 @@ static void SetCursorPosYAndSetupForPrevLine(float pos_y, float line_height)
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        table->RowBgColorCounter += (int)((off_y / line_height) + 0.5f);
+        table->RowBgColorCounter += (items_skipped >= 0) ? items_skipped : (int)((off_y / line_height) + 0.5f);
     }
 }
 
@@ -2217,7 +2766,8 @@ ImGuiListClipper::ImGuiListClipper(int items_count, float items_height)
     StepNo = 0;
     ItemsFrozen = 0;
     ItemsHeight = StartPosY = 0.0f;
-    Begin(items_count, items_height);
+    if (items_count != -1) // Default constructed clippers may outlive frames (e.g. as a member of ImGuiTableData) and be created before a context exists
+        Begin(items_count, items_height);
 }
 
 ImGuiListClipper::~ImGuiListClipper()
@@ -2354,6 +2904,191 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiVariableListClipper
+//-----------------------------------------------------------------------------
+// Step 0: Begin() was called. Frozen rows of a table are displayed unclipped first, like ImGuiListClipper does (StepNo 1).
+// Step 2: one item per call, starting with the first visible item. Each call measures the item submitted by the previous one.
+// Step 3: ended, the cursor has been advanced to the end of the list.
+//-----------------------------------------------------------------------------
+
+ImGuiVariableListClipper::ImGuiVariableListClipper()
+{
+    DisplayStart = DisplayEnd = 0;
+    ItemsCount = 0;
+    StepNo = 3;
+    ItemsFrozen = 0;
+    ItemsHeightEstimate = StartPosY = ItemStartPosY = 0.0f;
+}
+
+ImGuiVariableListClipper::~ImGuiVariableListClipper()
+{
+    IM_ASSERT(StepNo == 3 && "Forgot to call End(), or to Step() until false?");
+}
+
+void ImGuiVariableListClipper::Begin(int items_count, float items_height_estimate)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(items_count >= 0);
+
+    if (ImGuiTable* table = g.CurrentTable)
+        if (table->IsInsideRow)
+            ImGui::TableEndRow(table);
+
+    ItemsHeightEstimate = (items_height_estimate > 0.0f) ? items_height_estimate : ImGui::GetTextLineHeightWithSpacing();
+
+    // Items appended at the end are added to the tree one by one in O(log N), so a growing list (e.g. a log) doesn't need a full rebuild every frame.
+    // Removing items at the end only needs a resize since tree nodes never depend on items after them.
+    const int old_count = ItemsHeight.Size;
+    if (items_count > old_count)
+    {
+        ItemsHeight.reserve(items_count);
+        ItemsHeightTree.reserve(items_count);
+        for (int n = old_count; n < items_count; n++)
+        {
+            const int node = n + 1;
+            ItemsHeight.push_back(ItemsHeightEstimate);
+            ItemsHeightTree.push_back(ItemsHeightEstimate + GetItemOffset(n) - GetItemOffset(node - (node & -node)));
+        }
+    }
+    else if (items_count < old_count)
+    {
+        ItemsHeight.resize(items_count);
+        ItemsHeightTree.resize(items_count);
+    }
+
+    StartPosY = ItemStartPosY = window->DC.CursorPos.y;
+    ItemsCount = items_count;
+    ItemsFrozen = 0;
+    StepNo = 0;
+    DisplayStart = DisplayEnd = 0;
+}
+
+void ImGuiVariableListClipper::End()
+{
+    if (StepNo == 3) // Already ended
+        return;
+
+    // Seek to the end of the list, from wherever the last displayed item left the cursor
+    if (StepNo == 2 && ItemsCount > 0)
+        SetCursorPosYAndSetupForPrevLine(StartPosY + GetItemOffset(ItemsCount) - GetItemOffset(ItemsFrozen), ItemsHeight[ItemsCount - 1], ItemsCount - DisplayEnd);
+    StepNo = 3;
+}
+
+bool ImGuiVariableListClipper::Step()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(StepNo != 3 && "Forgot to call Begin()?");
+
+    ImGuiTable* table = g.CurrentTable;
+    if (table && table->IsInsideRow)
+        ImGui::TableEndRow(table);
+
+    // Measure the item submitted by the previous step (TableEndRow() leaves the cursor at the bottom of the tallest cell)
+    if (StepNo == 2)
+        SetItemHeight(DisplayStart, window->DC.CursorPos.y - ItemStartPosY);
+
+    // Reached end of list
+    if (DisplayEnd >= ItemsCount || GetSkipItemForListClipping())
+    {
+        End();
+        return false;
+    }
+
+    // While we are in frozen row state, keep displaying items one by one, unclipped
+    if (StepNo <= 1 && table != NULL && !table->IsFreezeRowsPassed)
+    {
+        DisplayStart = ItemsFrozen;
+        DisplayEnd = ++ItemsFrozen;
+        StepNo = 1;
+        return true;
+    }
+
+    const ImRect unclipped_rect = GetListClippingRect(window);
+    const bool nav_move_up = (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up);
+    const bool nav_move_down = (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down);
+    if (StepNo <= 1)
+    {
+        // Seek cursor to the first visible item. When performing a navigation request, ensure we have one item extra in the direction we are moving to.
+        StartPosY = window->DC.CursorPos.y;
+        const float frozen_offset = GetItemOffset(ItemsFrozen);
+        int start = g.LogEnabled ? ItemsFrozen : FindItemAtOffset(frozen_offset + unclipped_rect.Min.y - StartPosY) - (nav_move_up ? 1 : 0);
+        start = ImClamp(start, ItemsFrozen, ItemsCount - 1);
+        if (start > ItemsFrozen)
+            SetCursorPosYAndSetupForPrevLine(StartPosY + GetItemOffset(start) - frozen_offset, ItemsHeight[start - 1], start - ItemsFrozen);
+        DisplayStart = start;
+        DisplayEnd = start + 1;
+        ItemStartPosY = window->DC.CursorPos.y;
+        StepNo = 2;
+        return true;
+    }
+
+    // Continue with the next item until we pass the bottom of the visible area
+    const float max_y = unclipped_rect.Max.y + (nav_move_down ? ItemsHeight[DisplayEnd] : 0.0f);
+    if (g.LogEnabled || window->DC.CursorPos.y < max_y)
+    {
+        DisplayStart = DisplayEnd;
+        DisplayEnd++;
+        ItemStartPosY = window->DC.CursorPos.y;
+        return true;
+    }
+    End();
+    return false;
+}
+
+void ImGuiVariableListClipper::InvalidateHeights()
+{
+    // Linear time build: each node adds its sum to its parent
+    const int count = ItemsHeight.Size;
+    for (int n = 0; n < count; n++)
+        ItemsHeight[n] = ItemsHeightTree[n] = ItemsHeightEstimate;
+    for (int node = 1; node <= count; node++)
+    {
+        const int parent = node + (node & -node);
+        if (parent <= count)
+            ItemsHeightTree[parent - 1] += ItemsHeightTree[node - 1];
+    }
+}
+
+void ImGuiVariableListClipper::SetItemHeight(int item_index, float height)
+{
+    IM_ASSERT(item_index >= 0 && item_index < ItemsHeight.Size);
+    const float delta = height - ItemsHeight[item_index];
+    if (delta == 0.0f)
+        return;
+    ItemsHeight[item_index] = height;
+    for (int node = item_index + 1; node <= ItemsHeightTree.Size; node += node & -node)
+        ItemsHeightTree[node - 1] += delta;
+}
+
+float ImGuiVariableListClipper::GetItemOffset(int item_index) const
+{
+    IM_ASSERT(item_index >= 0 && item_index <= ItemsHeightTree.Size);
+    float offset = 0.0f;
+    for (int node = item_index; node > 0; node -= node & -node)
+        offset += ItemsHeightTree[node - 1];
+    return offset;
+}
+
+int ImGuiVariableListClipper::FindItemAtOffset(float offset) const
+{
+    // Descend the implicit tree from the largest power of two, skipping whole nodes which end before 'offset'
+    const int count = ItemsHeightTree.Size;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    int item_index = 0;
+    for (; step > 0; step >>= 1)
+        if (item_index + step <= count && ItemsHeightTree[item_index + step - 1] <= offset)
+        {
+            item_index += step;
+            offset -= ItemsHeightTree[item_index - 1];
+        }
+    return ImMin(item_index, ImMax(count - 1, 0));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2859,6 +3594,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     SkipItems = false;
     Appearing = false;
     Hidden = false;
+    ContentRetained = false;
     IsFallbackWindow = false;
     HasCloseButton = false;
     ResizeBorderHeld = -1;
@@ -2884,6 +3620,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
+    DrawListSpare = NULL;
     ParentWindow = NULL;
     RootWindow = NULL;
     RootWindowForTitleBarHighlight = NULL;
@@ -2899,7 +3636,9 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
 ImGuiWindow::~ImGuiWindow()
 {
-    IM_ASSERT(DrawList == &DrawListInst);
+    IM_ASSERT(DrawList == &DrawListInst || DrawListSpare == &DrawListInst);
+    if (DrawListSpare)
+        IM_DELETE(DrawList == &DrawListInst ? DrawListSpare : DrawList);
     IM_DELETE(Name);
     for (int i = 0; i != ColumnsStorage.Size; i++)
         ColumnsStorage[i].~ImGuiColumns();
@@ -3006,6 +3745,9 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    if (window->DrawListSpare)
+        window->DrawListSpare->_ClearFreeMemory();
+    window->Retained.IdleBuilds = 0;
     window->DC.ChildWindows.clear();
     window->DC.ItemFlagsStack.clear();
     window->DC.ItemWidthStack.clear();
@@ -3294,9 +4036,24 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
+    ImGuiContext* ctx = GImGui;
+    if (ctx)
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->FrameAllocations++;
+    }
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    char* ptr = (char*)GImAllocatorAllocFunc(size + IM_MEMSTATS_HEADER_SIZE, GImAllocatorUserData);
+    if (ptr == NULL)
+        return NULL;
+    ImGuiMemStatsHeader* header = (ImGuiMemStatsHeader*)(void*)ptr;
+    header->Size = size;
+    header->Tag = ctx ? ctx->MemTag : ImGuiMemTag_Misc;
+    MemStatsAdd(header->Tag, (ImS64)size);
+    return ptr + IM_MEMSTATS_HEADER_SIZE;
+#else
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3305,9 +4062,84 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    if (ptr)
+    {
+        ImGuiMemStatsHeader* header = (ImGuiMemStatsHeader*)(void*)((char*)ptr - IM_MEMSTATS_HEADER_SIZE);
+        MemStatsSub(header->Tag, (ImS64)header->Size);
+        ptr = header;
+    }
+#endif
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+void ImGui::GetMemStats(ImGuiMemStats out_stats[], ImGuiMemStats* out_total)
+{
+    for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+    {
+        ImGuiMemStats* dst = (n < ImGuiMemTag_COUNT) ? &out_stats[n] : out_total;
+        if (dst == NULL)
+            continue;
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+        const ImGuiMemStatsCounters& src = GImMemStatsCounters[n];
+        dst->Bytes = src.Bytes.load(std::memory_order_relaxed);
+        dst->PeakBytes = src.PeakBytes.load(std::memory_order_relaxed);
+        dst->Allocations = src.Allocations.load(std::memory_order_relaxed);
+        dst->TotalAllocations = src.TotalAllocations.load(std::memory_order_relaxed);
+#else
+        *dst = ImGuiMemStats();
+#endif
+    }
+}
+
+ImGuiMemTag ImGui::SetMemTag(ImGuiMemTag tag)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    ImGuiMemTag prev_tag = g.MemTag;
+    g.MemTag = tag;
+    return prev_tag;
+}
+
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.WithinFrameScope);
+    return g.FrameArena.Alloc(size);
+}
+
+void ImFrameArena::AddBlock(size_t min_size)
+{
+    // Grow geometrically within a frame, Reset() merges the blocks afterwards
+    size_t size = ImMax(min_size, (size_t)(Blocks.Size > 0 ? Blocks.back().Size * 2 : 4096));
+    ImFrameArenaBlock block;
+    block.Data = (char*)IM_ALLOC(size);
+    block.Size = (int)size;
+    Blocks.push_back(block);
+    BlockUsed = 0;
+}
+
+void ImFrameArena::Reset()
+{
+    if (Blocks.Size > 1)
+    {
+        const int size = GetReservedBytes();
+        Clear();
+        AddBlock((size_t)size);
+    }
+    BlockUsed = 0;
+    UsedBytesPreviousFrame = UsedBytes;
+    UsedBytes = 0;
+}
+
+void ImFrameArena::Clear()
+{
+    for (int n = 0; n < Blocks.Size; n++)
+        IM_FREE(Blocks[n].Data);
+    Blocks.clear();
+    BlockUsed = 0;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3368,6 +4200,93 @@ void ImGui::DestroyContext(ImGuiContext* ctx)
     IM_DELETE(ctx);
 }
 
+ImGuiContext* ImGui::CreateWorkerContext(ImGuiContext* parent)
+{
+    if (parent == NULL)
+        parent = GImGui;
+    IM_ASSERT(parent != NULL && parent->ParentContext == NULL);
+    ImGuiContext* ctx = IM_NEW(ImGuiContext)(parent->IO.Fonts);
+    ctx->ParentContext = parent;
+    Initialize(ctx);
+    ctx->IO.IniFilename = NULL;
+    ctx->IO.LogFilename = NULL;
+    ctx->IO.MouseDrawCursor = false;    // Drawn once by the parent
+    return ctx;
+}
+
+// Copy the state the parent got from the platform back-end this frame. Only raw inputs are copied:
+// derived state (clicks, durations, repeat) is computed by the worker own NewFrame() from its previous frame.
+void ImGui::NewWorkerFrame(ImGuiContext* worker)
+{
+    IM_ASSERT(worker != NULL && worker->ParentContext != NULL);
+    const ImGuiContext& parent = *worker->ParentContext;
+    IM_ASSERT(parent.WithinFrameScope && "Call NewWorkerFrame() after NewFrame() on the parent context!");
+    const ImGuiIO& src = parent.IO;
+    ImGuiIO& dst = worker->IO;
+    dst.ConfigFlags = src.ConfigFlags;
+    dst.BackendFlags = src.BackendFlags;
+    dst.DisplaySize = src.DisplaySize;
+    dst.DeltaTime = src.DeltaTime;
+    dst.MouseDoubleClickTime = src.MouseDoubleClickTime;
+    dst.MouseDoubleClickMaxDist = src.MouseDoubleClickMaxDist;
+    dst.MouseDragThreshold = src.MouseDragThreshold;
+    dst.KeyRepeatDelay = src.KeyRepeatDelay;
+    dst.KeyRepeatRate = src.KeyRepeatRate;
+    memcpy(dst.KeyMap, src.KeyMap, sizeof(src.KeyMap));
+    dst.FontGlobalScale = src.FontGlobalScale;
+    dst.FontAllowUserScaling = src.FontAllowUserScaling;
+    dst.FontDefault = src.FontDefault;
+    dst.DisplayFramebufferScale = src.DisplayFramebufferScale;
+    dst.ConfigMacOSXBehaviors = src.ConfigMacOSXBehaviors;
+    dst.ConfigInputTextCursorBlink = src.ConfigInputTextCursorBlink;
+    dst.ConfigWindowsResizeFromEdges = src.ConfigWindowsResizeFromEdges;
+    dst.ConfigWindowsMoveFromTitleBarOnly = src.ConfigWindowsMoveFromTitleBarOnly;
+    dst.ConfigWindowsMemoryCompactTimer = src.ConfigWindowsMemoryCompactTimer;
+    dst.MousePos = src.MousePos;
+    memcpy(dst.MouseDown, src.MouseDown, sizeof(src.MouseDown));
+    dst.MouseWheel = src.MouseWheel;
+    dst.MouseWheelH = src.MouseWheelH;
+    dst.KeyCtrl = src.KeyCtrl;
+    dst.KeyShift = src.KeyShift;
+    dst.KeyAlt = src.KeyAlt;
+    dst.KeySuper = src.KeySuper;
+    memcpy(dst.KeysDown, src.KeysDown, sizeof(src.KeysDown));
+    memcpy(dst.NavInputs, src.NavInputs, sizeof(src.NavInputs));
+    dst.InputQueueCharacters.resize(0);
+    if (!src.InputQueueCharacters.empty())
+        dst.InputQueueCharacters = src.InputQueueCharacters;
+    worker->Style = parent.Style;
+    worker->Time = parent.Time - src.DeltaTime; // So GetTime() matches the parent once NewFrame() advanced it
+
+    SetCurrentContext(worker);
+    NewFrame();
+}
+
+void ImGui::EndWorkerFrame()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.ParentContext != NULL && "Current context is not a worker context!");
+    Render();
+    SetCurrentContext(NULL);
+}
+
+void ImGui::MergeWorkerFrame(ImGuiContext* worker)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(worker != NULL && worker->ParentContext == &g);
+    IM_ASSERT(worker->FrameCountRendered == worker->FrameCount && "Call EndWorkerFrame() on the worker thread first!");
+    IM_ASSERT(g.WithinFrameScope && "Call MergeWorkerFrame() before Render()!");
+    g.WorkerContextsToMerge.push_back(worker);
+    if (g.MouseCursor == ImGuiMouseCursor_Arrow)
+        g.MouseCursor = worker->MouseCursor;
+    g.IO.WantCaptureMouse |= worker->IO.WantCaptureMouse;
+    g.IO.WantCaptureKeyboard |= worker->IO.WantCaptureKeyboard;
+    g.IO.WantTextInput |= worker->IO.WantTextInput;
+    g.TextSizeCacheHits += worker->TextSizeCacheHits;
+    g.TextSizeCacheMisses += worker->TextSizeCacheMisses;
+    g.FrameAllocations += worker->FrameAllocations;
+}
+
 ImGuiIO& ImGui::GetIO()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
@@ -3808,7 +4727,14 @@ void ImGui::NewFrame()
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
+    g.TextSizeCacheHitsPreviousFrame = g.TextSizeCacheHits;
+    g.TextSizeCacheMissesPreviousFrame = g.TextSizeCacheMisses;
+    g.TextSizeCacheHits = g.TextSizeCacheMisses = 0;
+    g.IO.MetricsFrameAllocations = g.FrameAllocations;
+    g.FrameAllocations = 0;
+    g.FrameArena.Reset();
     g.MenusIdSubmittedThisFrame.resize(0);
+    g.WorkerContextsToMerge.resize(0);
 
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
@@ -3816,8 +4742,14 @@ void ImGui::NewFrame()
     g.FramerateSecPerFrameIdx = (g.FramerateSecPerFrameIdx + 1) % IM_ARRAYSIZE(g.FramerateSecPerFrame);
     g.IO.Framerate = (g.FramerateSecPerFrameAccum > 0.0f) ? (1.0f / (g.FramerateSecPerFrameAccum / (float)IM_ARRAYSIZE(g.FramerateSecPerFrame))) : FLT_MAX;
 
-    // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // Rasterize glyphs requested during the previous frame, then setup current font and draw list shared data
+    // (worker contexts leave the shared atlas to their parent, which only updates it while they are idle)
+    if (g.ParentContext == NULL)
+    {
+        if (g.IO.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs)
+            g.IO.Fonts->BuildPendingGlyphs();
+        g.IO.Fonts->Locked = true;
+    }
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3826,7 +4758,7 @@ void ImGui::NewFrame()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
@@ -4079,6 +5011,8 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
+    g.TextSizeCache.clear();
+    g.FrameArena.Clear();
 
     g.Tables.Clear();
     g.CurrentTableStack.clear();
@@ -4183,15 +5117,17 @@ static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWin
 }
 
 // Layer is locked for the root window, however child windows may use a different viewport (e.g. extruding menu)
+// Worker contexts put popups in a layer of their own, so their parent can draw them above its windows with the tooltips (see Render())
 static void AddRootWindowToDrawData(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    int layer = (window->Flags & ImGuiWindowFlags_Tooltip) ? 1 : 0;
+    int layer = (window->Flags & ImGuiWindowFlags_Tooltip) ? 2 : (g.ParentContext != NULL && (window->Flags & ImGuiWindowFlags_Popup)) ? 1 : 0;
     AddWindowToDrawData(&g.DrawDataBuilder.Layers[layer], window);
 }
 
 void ImDrawDataBuilder::FlattenIntoSingleLayer()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     int n = Layers[0].Size;
     int size = n;
     for (int i = 1; i < IM_ARRAYSIZE(Layers); i++)
@@ -4316,7 +5252,8 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (g.ParentContext == NULL)
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
@@ -4339,6 +5276,15 @@ void ImGui::Render()
     if (!g.BackgroundDrawList.VtxBuffer.empty())
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
 
+    // Add ImDrawList of the windows recorded by worker contexts, already in their own back-to-front order
+    for (int worker_n = 0; worker_n < g.WorkerContextsToMerge.Size; worker_n++)
+    {
+        ImGuiContext* worker = g.WorkerContextsToMerge[worker_n];
+        for (int n = 0; n < worker->DrawDataOverlayStart; n++)
+            AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], worker->DrawData.CmdLists[n]);
+        g.IO.MetricsRenderWindows += worker->IO.MetricsRenderWindows;
+    }
+
     // Add ImDrawList to render
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
@@ -4352,6 +5298,15 @@ void ImGui::Render()
     for (int n = 0; n < IM_ARRAYSIZE(windows_to_render_top_most); n++)
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
+
+    // Add the tooltips, popups and foreground ImDrawList of worker contexts above all windows
+    for (int worker_n = 0; worker_n < g.WorkerContextsToMerge.Size; worker_n++)
+    {
+        ImGuiContext* worker = g.WorkerContextsToMerge[worker_n];
+        for (int n = worker->DrawDataOverlayStart; n < worker->DrawData.CmdListsCount; n++)
+            AddDrawListToDrawData(&g.DrawDataBuilder.Layers[2], worker->DrawData.CmdLists[n]);
+    }
+    g.DrawDataOverlayStart = g.DrawDataBuilder.Layers[0].Size;
     g.DrawDataBuilder.FlattenIntoSingleLayer();
 
     // Draw software mouse cursor if requested
@@ -4376,6 +5331,36 @@ void ImGui::Render()
 
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
+#if IMGUI_TEXT_SIZE_CACHE_SIZE > 0
+// Key of the CalcTextSize() cache. Texts are hashed 8 bytes at a time: this needs to be much cheaper than measuring them,
+// which ImHashStr() processing one byte at a time isn't. Never returns 0, which marks unused entries.
+static ImU64 CalcTextSizeCacheKey(const char* text, const char* text_end, const ImFont* font, float font_size, float wrap_width)
+{
+    const ImU64 mul = 0x9E3779B97F4A7C15ULL;
+    ImU32 font_size_bits, wrap_width_bits;
+    memcpy(&font_size_bits, &font_size, sizeof(font_size_bits));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(wrap_width_bits));
+    ImU64 h = (ImU64)(size_t)font ^ ((ImU64)font->ContainerAtlas->TexGlyphsGeneration << 40);
+    h = (h ^ (((ImU64)font_size_bits << 32) | wrap_width_bits)) * mul;
+    h = (h ^ (ImU64)(text_end - text)) * mul;
+    for (; text_end - text >= 8; text += 8)
+    {
+        ImU64 v;
+        memcpy(&v, text, sizeof(v));
+        h = (h ^ v) * mul;
+        h ^= h >> 29;
+    }
+    if (text < text_end)
+    {
+        ImU64 v = 0;
+        memcpy(&v, text, (size_t)(text_end - text));
+        h = (h ^ v) * mul;
+    }
+    h ^= h >> 32;
+    return h ? h : 1;
+}
+#endif
+
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
 {
     ImGuiContext& g = *GImGui;
@@ -4390,11 +5375,49 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+#if IMGUI_TEXT_SIZE_CACHE_SIZE > 0
+    // Labels, headers and cells are measured again every frame: look up the size measured by an earlier call
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+    ImGuiTextSizeCacheEntry* entry = NULL;
+    ImU64 key = 0;
+    if (text_display_end - text >= IMGUI_TEXT_SIZE_CACHE_MIN_LEN)
+    {
+        key = CalcTextSizeCacheKey(text, text_display_end, font, font_size, wrap_width);
+        if (g.TextSizeCache.Size == 0)
+        {
+            IM_STATIC_ASSERT((IMGUI_TEXT_SIZE_CACHE_SIZE & (IMGUI_TEXT_SIZE_CACHE_SIZE - 1)) == 0);
+            g.TextSizeCache.resize(IMGUI_TEXT_SIZE_CACHE_SIZE);
+            memset(g.TextSizeCache.Data, 0, (size_t)g.TextSizeCache.size_in_bytes());
+        }
+        entry = &g.TextSizeCache.Data[key & (IMGUI_TEXT_SIZE_CACHE_SIZE - 1)];
+        if (entry->Key == key && entry->Font == font && entry->FontSize == font_size && entry->WrapWidth == wrap_width && entry->TextLength == (int)(text_display_end - text) && entry->TexGlyphsGeneration == font->ContainerAtlas->TexGlyphsGeneration)
+        {
+            g.TextSizeCacheHits++;
+            return entry->Size;
+        }
+        g.TextSizeCacheMisses++;
+    }
+#endif
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     text_size.x = IM_FLOOR(text_size.x + 0.95f);
 
+#if IMGUI_TEXT_SIZE_CACHE_SIZE > 0
+    if (entry != NULL)
+    {
+        entry->Key = key;
+        entry->Font = font;
+        entry->FontSize = font_size;
+        entry->WrapWidth = wrap_width;
+        entry->TextLength = (int)(text_display_end - text);
+        entry->TexGlyphsGeneration = font->ContainerAtlas->TexGlyphsGeneration;
+        entry->Size = text_size;
+    }
+#endif
     return text_size;
 }
 
@@ -4962,6 +5985,7 @@ static void ApplyWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* settin
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
@@ -5521,12 +6545,45 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
+// Is the window free of anything that may change its rendering without its contents changing (hover, active item, nav highlight, moving)?
+static bool IsWindowContentIdle(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* root_window = window->RootWindow;
+    if (g.HoveredRootWindow == root_window || (g.MovingWindow && g.MovingWindow->RootWindow == root_window))
+        return false;
+    if (g.ActiveId != 0 && g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == root_window)
+        return false;
+    if (g.NavWindow && g.NavWindow->RootWindow == root_window && !g.NavDisableHighlight)
+        return false;
+    if (g.NavWindowingTarget || g.DragDropActive)
+        return false;
+    return true;
+}
+
+// Child windows of a window whose contents are retained are not submitted: keep them and their own draw lists alive.
+static void KeepRetainedChildWindowsAlive(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = 0; i < window->DC.ChildWindows.Size; i++)
+    {
+        ImGuiWindow* child = window->DC.ChildWindows[i];
+        if (!child->WasActive)
+            continue;
+        child->Active = true;
+        child->LastFrameActive = g.FrameCount;
+        child->LastTimeActive = (float)g.Time;
+        KeepRetainedChildWindowsAlive(child);
+    }
+}
+
 // Push a new Dear ImGui window to add widgets to.
 // - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
 // - Begin/End can be called multiple times during the frame with the same window name to append content.
 // - The window name is used as a unique identifier to preserve window information across frames (and save rudimentary information to the .ini file).
 //   You can use the "##" or "###" markers to use the same label with different id, or same id with different label. See documentation at the top of this file.
 // - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
+// - Also return false when the draw list of the previous frame is reused as-is, see SetNextWindowContentVersion().
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
@@ -5551,6 +6608,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
     const int current_frame = g.FrameCount;
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
+    bool content_versioned = false, content_idle = false, content_retain_candidate = false;
+    ImU32 content_version = 0;
+    ImVec2 content_backup_cursor_max_pos;
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
 
     // Update the Appearing flag
@@ -5668,6 +6728,24 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
+
+        // Content versioning (see SetNextWindowContentVersion())
+        // Build into the spare draw list, so the previous frame stays intact until we know whether it can be reused as-is.
+        content_versioned = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasContentVersion) != 0;
+        content_version = g.NextWindowData.ContentVersionVal;
+        content_idle = content_versioned && IsWindowContentIdle(window);
+        content_retain_candidate = content_idle && window->Retained.IdleBuilds >= 2 && window->Retained.Version == content_version && window->WasActive && !window->Appearing;
+        content_backup_cursor_max_pos = window->DC.CursorMaxPos;
+        window->ContentRetained = false;
+        if (content_versioned)
+        {
+            if (window->DrawListSpare == NULL)
+            {
+                window->DrawListSpare = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+                window->DrawListSpare->_OwnerName = window->Name;
+            }
+            ImSwap(window->DrawList, window->DrawListSpare);
+        }
         window->DrawList->_ResetForNewFrame();
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -5978,6 +7056,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // We also disabled this when we have dimming overlay behind this specific one child.
         // FIXME: More code may rely on explicit sorting of overlapping child window and would need to disable this somehow. Please get in contact if you are affected.
         {
+            ImDrawList* backup_draw_list = window->DrawList;
             bool render_decorations_in_parent = false;
             if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
                 if (window->DrawList->CmdBuffer.back().ElemCount == 0 && parent_window->DrawList->VtxBuffer.Size > 0)
@@ -5991,7 +7070,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
 
             if (render_decorations_in_parent)
-                window->DrawList = &window->DrawListInst;
+                window->DrawList = backup_draw_list;
         }
 
         // Draw navigation selection/windowing rectangle border
@@ -6058,7 +7137,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.MenuColumns.Update(3, style.ItemSpacing.x, window_just_activated_by_user);
         window->DC.TreeDepth = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
-        window->DC.ChildWindows.resize(0);
+        if (!content_retain_candidate)
+            window->DC.ChildWindows.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -6159,6 +7239,45 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
                 skip_items = true;
         window->SkipItems = skip_items;
+
+        // Reuse the previous frame draw list if nothing it depends on changed, otherwise record what the new one depends on
+        if (content_versioned)
+        {
+            ImGuiWindowRetainedData& retained = window->Retained;
+            const bool focused = (g.NavWindow && g.NavWindow->RootWindow == window->RootWindow);
+            const bool state_unchanged = retained.Version == content_version && retained.Focused == focused &&
+                retained.Pos.x == window->Pos.x && retained.Pos.y == window->Pos.y && retained.Size.x == window->Size.x && retained.Size.y == window->Size.y &&
+                retained.Scroll.x == window->Scroll.x && retained.Scroll.y == window->Scroll.y &&
+                retained.InnerClipRect.Min.x == window->InnerClipRect.Min.x && retained.InnerClipRect.Min.y == window->InnerClipRect.Min.y &&
+                retained.InnerClipRect.Max.x == window->InnerClipRect.Max.x && retained.InnerClipRect.Max.y == window->InnerClipRect.Max.y &&
+                retained.Font == g.Font && retained.FontSize == g.FontSize && retained.FontGlyphsGeneration == g.IO.Fonts->TexGlyphsGeneration;
+            if (content_retain_candidate && state_unchanged && !skip_items && window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0)
+            {
+                ImSwap(window->DrawList, window->DrawListSpare);
+                window->DC.CursorMaxPos = content_backup_cursor_max_pos;
+                window->ContentRetained = window->SkipItems = true;
+                KeepRetainedChildWindowsAlive(window);
+            }
+            else
+            {
+                if (content_retain_candidate)
+                    window->DC.ChildWindows.resize(0);
+                retained.IdleBuilds = (content_idle && !skip_items) ? (state_unchanged ? retained.IdleBuilds + 1 : 1) : 0;
+                retained.Version = content_version;
+                retained.Focused = focused;
+                retained.Pos = window->Pos;
+                retained.Size = window->Size;
+                retained.Scroll = window->Scroll;
+                retained.InnerClipRect = window->InnerClipRect;
+                retained.Font = g.Font;
+                retained.FontSize = g.FontSize;
+                retained.FontGlyphsGeneration = g.IO.Fonts->TexGlyphsGeneration;
+            }
+        }
+        else
+        {
+            window->Retained.IdleBuilds = 0;
+        }
     }
 
     return !window->SkipItems;
@@ -6184,7 +7303,8 @@ void ImGui::End()
     // Close anything that is open
     if (window->DC.CurrentColumns)
         EndColumns();
-    PopClipRect();   // Inner window clip rectangle
+    if (!window->ContentRetained)
+        PopClipRect();   // Inner window clip rectangle (a retained draw list is left untouched, the clip rectangle was pushed to the spare one)
 
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
@@ -6703,6 +7823,13 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
+void ImGui::SetNextWindowContentVersion(ImU32 version)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_HasContentVersion;
+    g.NextWindowData.ContentVersionVal = version;
+}
+
 ImDrawList* ImGui::GetWindowDrawList()
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -10414,7 +11541,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
-    ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    ImGui::Text("%d active allocations, %d allocations in the previous frame", io.MetricsActiveAllocations, io.MetricsFrameAllocations);
+    ImGui::Text("Frame arena: %d bytes used in the previous frame, %d bytes reserved", g.FrameArena.UsedBytesPreviousFrame, g.FrameArena.GetReservedBytes());
+    const int text_size_cache_calls = g.TextSizeCacheHitsPreviousFrame + g.TextSizeCacheMissesPreviousFrame;
+    ImGui::Text("CalcTextSize() cache: %d hits, %d misses (%.1f%%)", g.TextSizeCacheHitsPreviousFrame, g.TextSizeCacheMissesPreviousFrame, text_size_cache_calls > 0 ? g.TextSizeCacheHitsPreviousFrame * 100.0f / text_size_cache_calls : 0.0f);
+    ImGui::SameLine(); MetricsHelpMarker("Calls of the previous frame, including the merged worker contexts. Sizes are cached per text, font, font size and wrap width.\nTexts shorter than IMGUI_TEXT_SIZE_CACHE_MIN_LEN are measured directly and not counted.");
     ImGui::Separator();
 
     // Helper functions to display common structures:
@@ -10558,9 +11689,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         for (int n = 0; n < 3; n++, idx_i++)
                         {
                             ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                            const ImVec2 uv = v.uv;
                             triangle[n] = v.pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                         }
 
                         ImGui::Selectable(buf, false);
@@ -10633,6 +11765,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
             ImGui::BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
             ImGui::BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+            if (window->DrawListSpare)
+                ImGui::BulletText("ContentVersion: 0x%08X, IdleBuilds: %d, Retained: %d", window->Retained.Version, window->Retained.IdleBuilds, window->ContentRetained);
             ImGui::BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
             ImGui::BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
             if (!window->NavRectRel[0].IsInverted())
@@ -10694,10 +11828,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeStorage(ImGuiStorage* storage, const char* label)
         {
-            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+            int entries = 0;
+            for (int n = 0; n < storage->Data.Size; n++)
+                entries += storage->IsPairValid(n) ? 1 : 0;
+            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, entries, storage->Data.size_in_bytes()))
                 return;
             for (int n = 0; n < storage->Data.Size; n++)
             {
+                if (!storage->IsPairValid(n))
+                    continue;
                 const ImGuiStorage::ImGuiStoragePair& p = storage->Data[n];
                 ImGui::BulletText("Key 0x%08X Value { i: %d }", p.key, p.val_i); // Important: we currently don't store a type, real value may not be integer.
             }
@@ -10741,6 +11880,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 ImGui::BulletText("ColumnsWidth: %.1f, AutoFitWidth: %.1f", table->ColumnsTotalWidth, table->ColumnsAutoFitWidth);
                 ImGui::BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
                 ImGui::BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+                ImGui::BulletText("DrawChannels: %d, DrawCmds: %d, MergeBytes: %d", table->LastDrawChannelsCount, table->LastDrawCmdCount, table->LastDrawMergeBytes);
                 for (int n = 0; n < table->ColumnsCount; n++)
                 {
                     const ImGuiTableColumn* column = &table->Columns[n];
@@ -10939,6 +12079,41 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::TreePop();
     }
 
+    // Memory statistics
+    if (ImGui::TreeNode("Memory"))
+    {
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+        const char* tag_names[] = { "Misc", "Windows", "DrawLists", "Fonts", "Tables", "Storage", "AppData" }; IM_ASSERT(IM_ARRAYSIZE(tag_names) == ImGuiMemTag_COUNT);
+        ImGuiMemStats stats[ImGuiMemTag_COUNT];
+        ImGuiMemStats total;
+        ImGui::GetMemStats(stats, &total);
+        ImGui::TextUnformatted("All contexts and threads, requested sizes.");
+        ImGui::SameLine(); MetricsHelpMarker("Allocations are attributed to the innermost tagged scope when MemAlloc() is called, see ImGuiMemTag_.\nThe total peak is the peak of the sum, not the sum of the peaks.");
+        if (ImGui::BeginTable("##memory", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingPolicyFixedX))
+        {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Bytes");
+            ImGui::TableSetupColumn("Peak bytes");
+            ImGui::TableSetupColumn("Allocations");
+            ImGui::TableSetupColumn("Total allocations");
+            ImGui::TableHeadersRow();
+            for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+            {
+                const ImGuiMemStats& tag_stats = (n < ImGuiMemTag_COUNT) ? stats[n] : total;
+                ImGui::TableNextColumn(); ImGui::TextUnformatted((n < ImGuiMemTag_COUNT) ? tag_names[n] : "Total");
+                ImGui::TableNextColumn(); ImGui::Text("%lld", (long long)tag_stats.Bytes);
+                ImGui::TableNextColumn(); ImGui::Text("%lld", (long long)tag_stats.PeakBytes);
+                ImGui::TableNextColumn(); ImGui::Text("%d", tag_stats.Allocations);
+                ImGui::TableNextColumn(); ImGui::Text("%d", tag_stats.TotalAllocations);
+            }
+            ImGui::EndTable();
+        }
+#else
+        ImGui::TextUnformatted("Define IMGUI_ENABLE_MEMORY_STATS in imconfig.h to count allocations per tag.");
+#endif
+        ImGui::TreePop();
+    }
+
     // Misc Details
     if (ImGui::TreeNode("Internal state"))
     {
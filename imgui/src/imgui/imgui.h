@@ -29,7 +29,7 @@ Index of this file:
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiVariableListClipper, ImGuiTableData, ImGuiPlotPyramid, ImColor)
 // Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
@@ -119,9 +119,10 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 with IMGUI_DRAWVERT_POS_FIXED16 + IMGUI_DRAWVERT_UV_UNORM16. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicData;      // [Internal] Data kept by ImFontAtlas to rasterize glyphs after Build() (ImFontAtlasFlags_DynamicGlyphs)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -130,15 +131,20 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiMemStats;               // Allocation counters for one memory tag, see GetMemStats()
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotPyramid;            // Helper holding min/max levels of a large series of values, to plot it in O(width)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableSortSpecsColumn;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiTableData;              // Helper for tables of many rows read from a data source, with sorting, filtering and clipping
+struct ImGuiTableDataColumn;        // Accessors for one column of an ImGuiTableData
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiVariableListClipper;    // Helper to manually clip large list of items of varying heights
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -149,6 +155,7 @@ typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
 typedef int ImGuiDir;               // -> enum ImGuiDir_             // Enum: A cardinal direction
 typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A key identifier (ImGui-side enum)
+typedef int ImGuiMemTag;            // -> enum ImGuiMemTag_          // Enum: A subsystem to attribute allocations to, for GetMemStats()
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
@@ -255,6 +262,18 @@ namespace ImGui
     IMGUI_API ImGuiContext* GetCurrentContext();
     IMGUI_API void          SetCurrentContext(ImGuiContext* ctx);
 
+    // Worker contexts: record independent windows on other threads.
+    // - A worker context shares the font atlas of its parent. Every frame it copies the parent inputs, time and style, so start it after the parent NewFrame().
+    // - On the worker thread: NewWorkerFrame(worker), Begin()/End() windows, EndWorkerFrame(). On the parent thread, once the worker is done: MergeWorkerFrame(worker), then Render().
+    // - Merged draw lists are drawn in this order: windows of the workers (in merge order), windows and popups of the parent, tooltips of the parent,
+    //   popups/tooltips/foreground draw list of each worker (in merge order), foreground draw list of the parent. They stay valid until the next NewWorkerFrame() of their worker.
+    // - Requires GImGui to be thread-local (see imconfig.h). Each context only knows its own windows for hovering and focus, so windows of different contexts should not overlap.
+    //   The font atlas must not be modified while workers run, and clipboard functions are not forwarded to workers. Destroy workers with DestroyContext() before their parent.
+    IMGUI_API ImGuiContext* CreateWorkerContext(ImGuiContext* parent = NULL);   // NULL = current context
+    IMGUI_API void          NewWorkerFrame(ImGuiContext* worker);               // make 'worker' current on the calling thread and start its frame
+    IMGUI_API void          EndWorkerFrame();                                   // finish the frame of the current worker (calls Render()) and clear the current context of the calling thread
+    IMGUI_API void          MergeWorkerFrame(ImGuiContext* worker);             // call on the parent thread: add the worker draw lists and its mouse/keyboard capture requests to the current frame
+
     // Main
     IMGUI_API ImGuiIO&      GetIO();                                    // access the IO structure (mouse/keyboard/gamepad inputs, time, various configuration options/flags)
     IMGUI_API ImGuiStyle&   GetStyle();                                 // access the Style structure (colors, sizes). Always use PushStyleCol(), PushStyleVar() to modify style mid-frame!
@@ -322,6 +341,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                 // set next window collapsed state. call before Begin()
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowContentVersion(ImU32 version);                                 // set next window content version (e.g. a hash of what you display). if it matches the previous frame and the window is idle (not hovered, active, moved or focused for navigation), the previous draw list is reused as-is and Begin() returns false: don't submit anything. call before Begin()
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -580,6 +600,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotPyramid& pyramid, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));      // large series: one min/max envelope per pixel column, see ImGuiPlotPyramid
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotPyramid& pyramid, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));  // "
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -846,6 +868,8 @@ namespace ImGui
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void          GetMemStats(ImGuiMemStats out_stats[], ImGuiMemStats* out_total = NULL); // Allocation counters of all contexts and threads. 'out_stats' needs ImGuiMemTag_COUNT elements. All zeros unless IMGUI_ENABLE_MEMORY_STATS is defined.
+    IMGUI_API ImGuiMemTag   SetMemTag(ImGuiMemTag tag);     // Attribute the following allocations made with the current context to 'tag', returns the previous one. Use with ImGuiMemTag_AppData around your own ImVector<>/IM_NEW() usage. Requires a current context.
 
 } // namespace ImGui
 
@@ -1545,6 +1569,21 @@ enum ImGuiCond_
     ImGuiCond_Appearing     = 1 << 3    // Set the variable if the object/window is appearing after being hidden/inactive (or the first time)
 };
 
+// Enumeration for GetMemStats() and SetMemTag()
+// Allocations are attributed to the innermost tagged scope active on the current context when MemAlloc() is called.
+// Allocations made without a current context (e.g. from font atlas build threads) count as ImGuiMemTag_Misc.
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Misc,           // Anything not covered below (contexts, settings, input text state, etc.)
+    ImGuiMemTag_Windows,        // Window structures and names (per-frame window stacks count as Misc)
+    ImGuiMemTag_DrawLists,      // Vertex, index and command buffers
+    ImGuiMemTag_Fonts,          // Font atlas texture, glyphs and lookup tables
+    ImGuiMemTag_Tables,         // Table columns, names and instance data
+    ImGuiMemTag_Storage,        // ImGuiStorage contents (tree node states, ImPool maps, etc.)
+    ImGuiMemTag_AppData,        // Set by the application with SetMemTag()
+    ImGuiMemTag_COUNT
+};
+
 //-----------------------------------------------------------------------------
 // Helpers: Memory allocations macros
 // IM_MALLOC(), IM_FREE(), IM_NEW(), IM_PLACEMENT_NEW(), IM_DELETE()
@@ -1561,6 +1600,17 @@ inline void  operator delete(void*, ImNewWrapper, void*)   {} // This is only re
 #define IM_NEW(_TYPE)                       new(ImNewWrapper(), ImGui::MemAlloc(sizeof(_TYPE))) _TYPE
 template<typename T> void IM_DELETE(T* p)   { if (p) { p->~T(); ImGui::MemFree(p); } }
 
+// Allocation counters for one ImGuiMemTag, see GetMemStats(). Sizes are the requested ones, without allocator overhead.
+struct ImGuiMemStats
+{
+    ImS64   Bytes;              // Bytes currently allocated
+    ImS64   PeakBytes;          // Highest value of Bytes since startup
+    int     Allocations;        // Allocations currently alive
+    int     TotalAllocations;   // MemAlloc() calls since startup
+
+    ImGuiMemStats() { Bytes = PeakBytes = 0; Allocations = TotalAllocations = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // Helper: ImVector<>
 // Lightweight std::vector<>-like class to avoid dragging dependencies (also, some implementations of STL with debug enabled are absurdly slow, we bypass it so our code runs fast in debug).
@@ -1798,6 +1848,7 @@ struct ImGuiIO
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsFrameAllocations;        // Number of MemAlloc() calls during the previous frame, including merged worker contexts. Transient buffers come from a frame arena, so this stays at 0 once the UI is stable.
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -2068,11 +2119,23 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_STORAGE_USE_HASH_MAP
+    // [Internal] Data is an open addressing table: a power-of-two number of slots followed by one slot for key 0, which marks free slots.
+    int                             Count;      // Number of pairs in the table, not counting key 0
+    int                             Capacity;   // Number of slots in the table, so Data.Size == Capacity + 1 unless pairs were pushed for BuildSortByKey()
+    bool                            HasZeroKey; // Pair with key 0 is stored in Data[Capacity]
+
+    ImGuiStorage()          { Count = Capacity = 0; HasZeroKey = false; }
+    void                Clear() { Data.clear(); Count = Capacity = 0; HasZeroKey = false; }
+    bool                IsPairValid(int n) const { return Data[n].key != 0 || (HasZeroKey && n == Data.Size - 1); }
+#else
+    void                Clear() { Data.clear(); }
+    bool                IsPairValid(int) const { return true; }     // Iterate pairs with 'for (int n = 0; n < Data.Size; n++) if (IsPairValid(n))' to support both implementations
+#endif
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N), or hashed with IMGUI_STORAGE_USE_HASH_MAP for O(1).
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2095,6 +2158,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (with IMGUI_STORAGE_USE_HASH_MAP: pairs pushed after the table are inserted into it)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2134,6 +2198,133 @@ struct ImGuiListClipper
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 };
 
+// Helper: Manually clip large list of items of varying heights (e.g. wrapped text, multi-line table rows).
+// Unlike ImGuiListClipper this needs to persist across frames: it keeps the height of every item, along with a Fenwick tree (binary indexed tree)
+// of their prefix sums, so seeking to the first visible item and updating the height of an item are both O(log N).
+// Items are measured when they are displayed. Items never displayed yet are assumed to have the estimated height passed to Begin().
+// Usage:
+//     static ImGuiVariableListClipper clipper; // or stored along with your list
+//     clipper.Begin(100000);                   // estimated height defaults to GetTextLineHeightWithSpacing()
+//     while (clipper.Step())
+//         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//             ImGui::TextWrapped("%s", my_items[i]);
+// - Step() returns the visible items one at a time (DisplayEnd == DisplayStart + 1), measuring each one on the next call, until the bottom of the visible area is reached.
+//   Then it advances the cursor to the end of the list and returns false.
+// - Items keep their index from frame to frame: call InvalidateHeights() if your list is reordered, or if the height of all items changed (e.g. new wrapping width).
+//   When items are only appended or removed at the end, changing 'items_count' is enough.
+struct ImGuiVariableListClipper
+{
+    int     DisplayStart;
+    int     DisplayEnd;
+    int     ItemsCount;
+
+    // [Internal]
+    int             StepNo;
+    int             ItemsFrozen;
+    float           ItemsHeightEstimate;
+    float           StartPosY;
+    float           ItemStartPosY;
+    ImVector<float> ItemsHeight;        // Height of each item, measured or estimated
+    ImVector<float> ItemsHeightTree;    // Fenwick tree over ItemsHeight[]: ItemsHeightTree[i] = sum of ItemsHeight[(i + 1) - ((i + 1) & -(i + 1)) .. i]
+
+    IMGUI_API ImGuiVariableListClipper();
+    IMGUI_API ~ImGuiVariableListClipper();
+
+    IMGUI_API void  Begin(int items_count, float items_height_estimate = -1.0f);
+    IMGUI_API void  End();                                              // Automatically called on the last call of Step() that returns false.
+    IMGUI_API bool  Step();                                             // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
+    IMGUI_API void  InvalidateHeights();                                // Reset all items to the estimated height.
+    IMGUI_API void  SetItemHeight(int item_index, float height);
+    IMGUI_API float GetItemOffset(int item_index) const;                // Distance from the top of the list to the top of an item, e.g. to scroll to it with SetScrollY().
+    IMGUI_API int   FindItemAtOffset(float offset) const;               // Index of the item at a distance from the top of the list.
+};
+
+// Accessors for one column of an ImGuiTableData. Both accessors are optional, but a column needs at least one to be displayed.
+// They receive the index of the column, so the same function may serve several columns.
+// - GetValue(): numerical value of a cell. Columns sort on it when provided: values are extracted once per sort, then radix sorted in linear time.
+// - GetText(): text of a cell, used for display, for filtering, and for sorting columns without GetValue(). Either return a pointer to your own
+//   zero-terminated string, or format into 'buf' and return it. When NULL, cells display their value with "%g".
+struct ImGuiTableDataColumn
+{
+    const char*             Label;
+    ImGuiTableColumnFlags   Flags;
+    float                   InitWidthOrWeight;  // 0.0f: default width or weight (same as -1.0f in TableSetupColumn())
+    double                  (*GetValue)(void* user_data, int row, int column);
+    const char*             (*GetText)(void* user_data, int row, int column, char* buf, int buf_size);
+};
+
+// Helper: Table of many rows read from a data source, through per-column accessors. Sorting, filtering and clipping are handled for you.
+// The helper keeps RowsOrder[], the indices of the rows passing filters in display order. It is only rebuilt when the sort specs change,
+// when the number of rows changes, or when you call SetDirty() (e.g. after your data or your filter changed), so it needs to persist across frames.
+// Usage:
+//     static const ImGuiTableDataColumn columns[] = { { "Name", 0, 0.0f, NULL, GetName }, { "Score", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, GetScore, NULL } };
+//     static ImGuiTableData table;
+//     if (table.Begin("##scores", columns, IM_ARRAYSIZE(columns), scores_count, scores, ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY, ImVec2(0, 300)))
+//     {
+//         while (table.Step())
+//             for (int i = table.DisplayStart; i < table.DisplayEnd; i++)
+//                 table.RowText(table.RowsOrder[i]);   // or your own TableNextRow()/TableNextColumn() calls for the row 'table.RowsOrder[i]'
+//         table.End();
+//     }
+// - Begin() calls BeginTable(), TableSetupColumn() for each column (with the column index as user id), TableSetupScrollFreeze() with ScrollY, and TableHeadersRow().
+// - Step() and DisplayStart/DisplayEnd work as in ImGuiListClipper, over RowsOrder[].
+// - Multi-column sorts are done one column at a time from the last sort spec to the first, each pass being stable. Ties keep the order of your rows.
+// - Sorting is done within the frame where the sort specs change. A sort on a number and a text column takes about 10 ms at 100k rows
+//   but 130 ms at 1M rows (-O2), so very large tables drop several frames when their sort changes.
+struct ImGuiTableData
+{
+    ImVector<int>       RowsOrder;              // Indices of the rows passing filters, in display order
+    int                 DisplayStart;           // Range of RowsOrder[] to display, set by Step()
+    int                 DisplayEnd;
+    ImGuiTextFilter*    Filter;                 // (Optional) Text filter, applied to the text of all columns with GetText() joined by tabs. Call SetDirty() when it changes.
+    bool                (*PassFilter)(void* user_data, int row); // (Optional) Your own filter. Call SetDirty() when it changes.
+
+    // [Internal]
+    const ImGuiTableDataColumn* Columns;
+    int                 ColumnsCount;
+    int                 RowsCount;
+    void*               UserData;
+    bool                Dirty;
+    ImGuiListClipper    Clipper;
+    ImVector<ImU64>     SortKeys;               // Scratch buffers for sorting
+    ImVector<ImU64>     SortKeysTemp;
+    ImVector<int>       SortRowsTemp;
+    ImVector<char>      SortTexts;              // Texts of the column being sorted, zero-terminated, and their offset for each row
+    ImVector<int>       SortTextsOffsets;
+
+    IMGUI_API ImGuiTableData();
+    IMGUI_API bool      Begin(const char* str_id, const ImGuiTableDataColumn* columns, int columns_count, int rows_count, void* user_data, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
+    IMGUI_API bool      Step();                 // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can display those rows.
+    IMGUI_API void      End();                  // Call only if Begin() returned true.
+    IMGUI_API void      RowText(int row);       // Display a row with the text of each column.
+    void                SetDirty()              { Dirty = true; }
+};
+
+// Helper: Min/max levels of a large series of values, for PlotLines() and PlotHistogram() with many more values than pixels.
+// Level 0 holds the values, and each next level the min/max of pairs of blocks of the previous one, so blocks of level n cover (1 << n) values.
+// Plots pick the level with the largest blocks not wider than a pixel column and draw one min/max envelope per column:
+// the cost of a frame is O(width) regardless of the number of values, and no peak is lost. Plot scale is also read from the top level.
+// Build() is O(N) and the pyramid is about twice the size of the values: rebuild it when your data changes, and keep it across frames.
+// Usage:
+//     static ImGuiPlotPyramid pyramid;
+//     if (scores_changed)
+//         pyramid.Build(scores, scores_count);
+//     ImGui::PlotHistogram("##scores", pyramid, NULL, 0.0f, FLT_MAX, ImVec2(0, 200));
+// - NaN values are ignored. With no more values than pixels, plots look the same as PlotLines()/PlotHistogram() with the values.
+struct ImGuiPlotPyramid
+{
+    ImVector<ImVec2>    Blocks;                 // Min (x) and max (y) of the blocks of all levels. Blocks of NaN values only are (FLT_MAX, -FLT_MAX).
+    ImVector<int>       LevelsOffset;           // Index in Blocks[] of the first block of each level
+    int                 ValuesCount;
+
+    ImGuiPlotPyramid()                          { ValuesCount = 0; }
+    IMGUI_API void      Build(const float* values, int values_count, int stride = sizeof(float));
+    void                Clear()                 { Blocks.clear(); LevelsOffset.clear(); ValuesCount = 0; }
+    int                 GetLevelsCount() const  { return LevelsOffset.Size; }
+    int                 GetBlocksCount(int level) const { return ValuesCount > 0 ? ((ValuesCount - 1) >> level) + 1 : 0; }
+    const ImVec2*       GetBlocks(int level) const { return Blocks.Data + LevelsOffset[level]; }
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2226,13 +2417,51 @@ struct ImDrawCmd
 typedef unsigned short ImDrawIdx;
 #endif
 
+// Compact vertex attributes (enabled with IMGUI_DRAWVERT_POS_FIXED16 / IMGUI_DRAWVERT_UV_UNORM16 in imconfig.h)
+// They convert from/to ImVec2, so code writing 'vtx->pos = ImVec2(x, y)' or reading 'ImVec2 p = vtx->pos' works with every layout.
+// - Positions are stored with IMGUI_DRAWVERT_POS_FRAC_BITS fractional bits: with the default of 3, that's 1/8 pixel precision in the -4096..+4095 range.
+//   Coordinates outside of the range are clamped, which is only exact for axis aligned shapes, so the display and any window content should fit in it.
+// - Texture coordinates are stored as 0..65535 for 0.0f..1.0f, which is 1/16 texel precision for a 4096 texels wide texture. Coordinates outside of 0..1 are clamped.
+// Back-ends should use normalized 16-bit attributes for uv and scale positions by 1.0f/(1 << IMGUI_DRAWVERT_POS_FRAC_BITS), e.g. in the projection matrix.
+#ifdef IMGUI_DRAWVERT_POS_FIXED16
+#ifndef IMGUI_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_DRAWVERT_POS_FRAC_BITS    3
+#endif
+struct ImDrawVertPosFixed16
+{
+    ImS16   X, Y;
+
+    ImDrawVertPosFixed16&   operator=(const ImVec2& v)  { X = Encode(v.x); Y = Encode(v.y); return *this; }
+    operator                ImVec2() const              { const float scale = 1.0f / (float)(1 << IMGUI_DRAWVERT_POS_FRAC_BITS); return ImVec2(X * scale, Y * scale); }
+    static inline ImS16     Encode(float v)             { v = v * (float)(1 << IMGUI_DRAWVERT_POS_FRAC_BITS) + 32768.5f; v = (v > 0.0f) ? v : 0.0f; v = (v < 65535.0f) ? v : 65535.0f; return (ImS16)((int)v - 32768); } // Biased so truncation rounds to nearest
+};
+#endif
+#ifdef IMGUI_DRAWVERT_UV_UNORM16
+struct ImDrawVertUVUnorm16
+{
+    ImU16   U, V;
+
+    ImDrawVertUVUnorm16&    operator=(const ImVec2& v)  { U = Encode(v.x); V = Encode(v.y); return *this; }
+    operator                ImVec2() const              { return ImVec2(U * (1.0f / 65535.0f), V * (1.0f / 65535.0f)); }
+    static inline ImU16     Encode(float v)             { v = (v > 0.0f) ? v : 0.0f; v = (v < 1.0f) ? v : 1.0f; return (ImU16)(int)(v * 65535.0f + 0.5f); }
+};
+#endif
+
 // Vertex layout
 #ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
 struct ImDrawVert
 {
-    ImVec2  pos;
-    ImVec2  uv;
-    ImU32   col;
+#ifdef IMGUI_DRAWVERT_POS_FIXED16
+    ImDrawVertPosFixed16    pos;    // 4 bytes
+#else
+    ImVec2                  pos;    // 8 bytes
+#endif
+#ifdef IMGUI_DRAWVERT_UV_UNORM16
+    ImDrawVertUVUnorm16     uv;     // 4 bytes
+#else
+    ImVec2                  uv;     // 8 bytes
+#endif
+    ImU32                   col;    // 4 bytes
 };
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
@@ -2318,9 +2547,12 @@ struct ImDrawList
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawCmd               _CmdHeader;         // [Internal] Template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
+    ImVec4                  _CullRect;          // [Internal] When not empty, primitives are culled against it rather than the current clip rect (set by tables, whose draw calls may be merged into a larger clip rect later)
+    ImU32                   _ContentHash;       // [Internal] Cached hash of the buffers, see ImDrawData::GetContentHash(). 0 when not computed since the last reset.
+    int                     _ContentHashVtxCount, _ContentHashIdxCount, _ContentHashCmdCount; // [Internal] Buffer sizes when _ContentHash was computed, to catch lists appended to afterwards.
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; }
+    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; _CullRect = ImVec4(0.0f, 0.0f, -1.0f, -1.0f); _ContentHash = 0; _ContentHashVtxCount = _ContentHashIdxCount = _ContentHashCmdCount = 0; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -2408,6 +2640,7 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _AddPolyline(const ImVec2* points, int num_points, ImU32 col, bool closed, float thickness);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2429,6 +2662,7 @@ struct ImDrawData
     ~ImDrawData()   { Clear(); }
     void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+    IMGUI_API ImU32 GetContentHash();                       // Helper to hash everything a renderer would consume (lists, commands, display rect). Equal hashes mean the frame would render identically, provided texture contents and user callbacks didn't change. Per-list hashes are cached, so lists reused from the previous frame are not hashed again.
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
@@ -2509,7 +2743,9 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // Only rasterize codepoints up to U+00FF in Build(). Other glyphs of the requested ranges are rasterized and packed the frame after they are first rendered (see BuildPendingGlyphs()). The renderer back-end needs to upload the dirty texture region (see GetTexDataDirtyRect()).
+    ImFontAtlasFlags_SDF                = 1 << 4    // Store glyphs as signed distance fields (see TexSdfSpread) so text stays sharp when scaled. The renderer back-end needs to threshold the texture alpha around 0.5 for the font texture. Implies ImFontAtlasFlags_NoBakedLines. Ignores OversampleH/OversampleV and RasterizerMultiply.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2555,6 +2791,14 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs)
+    // - Glyphs missing when rendering text are drawn with the fallback character and requested. ImGui::NewFrame() calls BuildPendingGlyphs() to rasterize them.
+    // - The texture may grow in height when it runs out of space, in which case the whole texture is dirty and its size changes.
+    // - The TTF data must stay available: ClearInputData() and ClearTexData() stop any further glyph loading.
+    IMGUI_API int               BuildPendingGlyphs();       // Rasterize and pack requested glyphs. Returns the number of glyphs added.
+    IMGUI_API bool              GetTexDataDirtyRect(int* out_x, int* out_y, int* out_width, int* out_height) const; // Texture region modified since the last ClearTexDataDirtyRect(), in pixels. Returns false if nothing changed.
+    void                        ClearTexDataDirtyRect()     { TexDirtyX0 = TexDirtyY0 = TexDirtyX1 = TexDirtyY1 = 0; } // Call once the dirty region has been uploaded.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2598,6 +2842,9 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    const char*                 BuildCacheFilename; // Path of a file caching the output of Build(), reused on next runs while fonts and settings are unchanged. Defaults to NULL (no cache). The TTF data is still loaded and hashed.
+    int                         TexSdfSpread;       // Distance in pixels encoded on each side of glyph edges with ImFontAtlasFlags_SDF. Defaults to 4. Larger values allow more downscaling and effects such as outlines, at the cost of texture space.
+    int                         BuildThreadsCount;  // Number of threads rasterizing glyphs in Build(). Defaults to 0 (use all hardware threads), 1 rasterizes on the calling thread. The texture is the same either way.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2611,6 +2858,9 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    int                         TexDirtyX0, TexDirtyY0, TexDirtyX1, TexDirtyY1;   // Texture region modified after Build() and not uploaded yet (empty when X0 >= X1).
+    unsigned int                TexGlyphsGeneration;// Incremented whenever glyphs are added after Build(), so text laid out or rendered earlier can be invalidated.
+    ImFontAtlasDynamicData*     DynamicData;        // Source fonts and rectangle packer kept alive for ImFontAtlasFlags_DynamicGlyphs
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
@@ -2647,6 +2897,8 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImVector<ImU32>             DynamicGlyphsAvailable; // out //         // 1-bit per codepoint in the requested ranges which is not rasterized yet (ImFontAtlasFlags_DynamicGlyphs).
+    ImVector<ImU32>             DynamicGlyphsPending;   // out //         // 1-bit per codepoint requested by FindGlyph() since the last ImFontAtlas::BuildPendingGlyphs(). Set atomically, text may be rendered from several threads.
 
     // Methods
     IMGUI_API ImFont();
@@ -2668,6 +2920,8 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              RequestDynamicGlyph(ImWchar c) const;
+    IMGUI_API void              AddGlyphToLookupTable(int glyph_idx);
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
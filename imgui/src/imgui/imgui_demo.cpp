@@ -6228,7 +6228,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), variable height, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -6264,6 +6265,27 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(), manually coarsely clipped - demonstrate how to use the ImGuiVariableListClipper helper.
+            // The clipper remembers the height of each line, so it needs to persist across frames.
+            static ImGuiVariableListClipper clipper;
+            static float wrap_width = 0.0f;
+            if (wrap_width != ImGui::GetContentRegionAvail().x)
+            {
+                wrap_width = ImGui::GetContentRegionAvail().x;
+                clipper.InvalidateHeights();
+            }
+            clipper.Begin(lines);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog", i);
+                    for (int n = 0; n < i % 4; n++)
+                        ImGui::TextWrapped("   ...and over the lazy dog's sleepy cat, again and again and again.");
+                }
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
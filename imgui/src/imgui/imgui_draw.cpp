@@ -35,6 +35,18 @@ Index of this file:
 #include "imgui_internal.h"
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <thread>       // std::thread (font atlas build)
+#include <atomic>       // std::atomic (font atlas build)
+#if !defined(IMGUI_DISABLE_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#define IMGUI_FONTATLAS_CACHE_MMAP
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>     // _InterlockedOr
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__APPLE__) || defined(__NEWLIB__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -389,6 +401,17 @@ void ImDrawListSharedData::SetCircleSegmentMaxError(float max_error)
     }
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+// Grow a draw list buffer with the allocation counted as ImGuiMemTag_DrawLists.
+// Callers check the capacity first, so the tag scope is only paid when the buffer actually grows, not on every primitive.
+template<typename T>
+static void ImDrawListGrowBuffer(ImVector<T>& buffer, int new_size)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    buffer.reserve(buffer._grow_capacity(new_size));
+}
+#endif
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
@@ -410,6 +433,8 @@ void ImDrawList::_ResetForNewFrame()
     _TextureIdStack.resize(0);
     _Path.resize(0);
     _Splitter.Clear();
+    _CullRect = ImVec4(0.0f, 0.0f, -1.0f, -1.0f);
+    _ContentHash = 0;
     CmdBuffer.push_back(ImDrawCmd());
 }
 
@@ -426,6 +451,7 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _ContentHash = 0;
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -447,6 +473,10 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+        ImDrawListGrowBuffer(CmdBuffer, CmdBuffer.Size + 1);
+#endif
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -608,10 +638,16 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
+    int idx_buffer_old_size = IdxBuffer.Size;
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    if (vtx_buffer_old_size + vtx_count > VtxBuffer.Capacity)
+        ImDrawListGrowBuffer(VtxBuffer, vtx_buffer_old_size + vtx_count);
+    if (idx_buffer_old_size + idx_count > IdxBuffer.Capacity)
+        ImDrawListGrowBuffer(IdxBuffer, idx_buffer_old_size + idx_count);
+#endif
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
-    int idx_buffer_old_size = IdxBuffer.Size;
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
@@ -672,11 +708,281 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     _IdxWritePtr += 6;
 }
 
+// Rectangle the GPU scissor of the current command is known to stay within: the current clipping rectangle,
+// or the larger _CullRect set by tables, which may merge the commands of their columns into a larger clipping rectangle after drawing.
+static inline const ImVec4& ImDrawListGetCullRect(const ImDrawList* draw_list)
+{
+    return (draw_list->_CullRect.x <= draw_list->_CullRect.z) ? draw_list->_CullRect : draw_list->_CmdHeader.ClipRect;
+}
+
+// Primitives entirely outside of the culling rectangle are skipped before generating any geometry, as the GPU scissor would discard it anyway.
+// 'margin' covers what the geometry adds around the shape's bounding box (anti-aliasing fringe, stroke thickness and joins).
+static inline bool ImDrawListIsClippedOut(const ImDrawList* draw_list, const ImVec2& p_min, const ImVec2& p_max, float margin)
+{
+#ifdef IMGUI_DISABLE_DRAWLIST_CULLING
+    IM_UNUSED(draw_list); IM_UNUSED(p_min); IM_UNUSED(p_max); IM_UNUSED(margin);
+    return false;
+#else
+    const ImVec4& cr = ImDrawListGetCullRect(draw_list);
+    return p_max.x + margin <= cr.x || p_max.y + margin <= cr.y || p_min.x - margin >= cr.z || p_min.y - margin >= cr.w;
+#endif
+}
+
+#define IM_DRAWLIST_POLYLINE_MIN_CULLED_SEGMENTS    16
+
+// Margin of stroked shapes: half the thickness plus the AA fringe, times up to 1.42 at joins (see IM_FIXNORMAL2F)
+static inline float ImDrawListStrokeMargin(float thickness) { return ImMax(thickness, 1.0f) + 2.0f; }
+
+#ifndef IMGUI_DISABLE_DRAWLIST_CULLING
+// Bounding box of 'points_count' points. With SSE, four points are processed at once.
+static void ImPolylineComputeBoundingBox(const ImVec2* points, const int points_count, ImVec2* out_min, ImVec2* out_max)
+{
+    ImVec2 bb_min = points[0], bb_max = points[0];
+    int i = 1;
+#ifdef IMGUI_ENABLE_SSE
+    if (points_count >= 4)
+    {
+        __m128 min01 = _mm_loadu_ps(&points[0].x), max01 = min01;
+        __m128 min23 = _mm_loadu_ps(&points[2].x), max23 = min23;
+        for (i = 4; i + 4 <= points_count; i += 4)
+        {
+            const __m128 p01 = _mm_loadu_ps(&points[i].x);
+            const __m128 p23 = _mm_loadu_ps(&points[i + 2].x);
+            min01 = _mm_min_ps(min01, p01); max01 = _mm_max_ps(max01, p01);
+            min23 = _mm_min_ps(min23, p23); max23 = _mm_max_ps(max23, p23);
+        }
+        min01 = _mm_min_ps(min01, min23); min01 = _mm_min_ps(min01, _mm_movehl_ps(min01, min01));
+        max01 = _mm_max_ps(max01, max23); max01 = _mm_max_ps(max01, _mm_movehl_ps(max01, max01));
+        _mm_storel_pi((__m64*)(void*)&bb_min, min01);
+        _mm_storel_pi((__m64*)(void*)&bb_max, max01);
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        bb_min.x = ImMin(bb_min.x, points[i].x); bb_min.y = ImMin(bb_min.y, points[i].y);
+        bb_max.x = ImMax(bb_max.x, points[i].x); bb_max.y = ImMax(bb_max.y, points[i].y);
+    }
+    *out_min = bb_min;
+    *out_max = bb_max;
+}
+
+// Index of the first segment [i1, i1 + 1] from 'i1' which is entirely outside of 'clip_rect' expanded by 'margin' (or, with 'clipped' == false, which is not),
+// or points_count - 1 if there is none. With SSE, four segments are tested at once.
+static int ImPolylineFindSegment(const ImVec2* points, int i1, const int points_count, const ImVec4& clip_rect, float margin, bool clipped)
+{
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 margin4 = _mm_set1_ps(margin);
+    const __m128 clip_x1 = _mm_set1_ps(clip_rect.x), clip_y1 = _mm_set1_ps(clip_rect.y), clip_x2 = _mm_set1_ps(clip_rect.z), clip_y2 = _mm_set1_ps(clip_rect.w);
+    const int mask_xor = clipped ? 0 : 0x0F;
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const float* p = &points[i1].x;
+        const __m128 a01 = _mm_loadu_ps(p + 0), a23 = _mm_loadu_ps(p + 4);      // Points i1 .. i1 + 3
+        const __m128 b01 = _mm_loadu_ps(p + 2), b23 = _mm_loadu_ps(p + 6);      // Points i1 + 1 .. i1 + 4
+        const __m128 ax = _mm_shuffle_ps(a01, a23, _MM_SHUFFLE(2, 0, 2, 0)), ay = _mm_shuffle_ps(a01, a23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 bx = _mm_shuffle_ps(b01, b23, _MM_SHUFFLE(2, 0, 2, 0)), by = _mm_shuffle_ps(b01, b23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 out_x = _mm_or_ps(_mm_cmple_ps(_mm_add_ps(_mm_max_ps(ax, bx), margin4), clip_x1), _mm_cmpge_ps(_mm_sub_ps(_mm_min_ps(ax, bx), margin4), clip_x2));
+        const __m128 out_y = _mm_or_ps(_mm_cmple_ps(_mm_add_ps(_mm_max_ps(ay, by), margin4), clip_y1), _mm_cmpge_ps(_mm_sub_ps(_mm_min_ps(ay, by), margin4), clip_y2));
+        if (const int mask = _mm_movemask_ps(_mm_or_ps(out_x, out_y)) ^ mask_xor)
+        {
+#if defined(_MSC_VER)
+            unsigned long bit_n;
+            _BitScanForward(&bit_n, (unsigned long)mask);
+            return i1 + (int)bit_n;
+#else
+            return i1 + __builtin_ctz((unsigned int)mask);
+#endif
+        }
+    }
+#endif
+    for (; i1 < points_count - 1; i1++)
+    {
+        const ImVec2& p1 = points[i1];
+        const ImVec2& p2 = points[i1 + 1];
+        const bool out = ImMax(p1.x, p2.x) + margin <= clip_rect.x || ImMax(p1.y, p2.y) + margin <= clip_rect.y || ImMin(p1.x, p2.x) - margin >= clip_rect.z || ImMin(p1.y, p2.y) - margin >= clip_rect.w;
+        if (out == clipped)
+            break;
+    }
+    return i1;
+}
+#endif
+
 // On AddPolyline() and AddConvexPolyFilled() we intentionally avoid using ImVec2 and superfluous function calls to optimize debug/non-inlined builds.
 // Those macros expects l-values.
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 #define IM_FIXNORMAL2F(VX,VY)               do { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; } while (0)
 
+// Write the normal of each segment of a polyline: out_normals[i] is for segment [i, i+1], the last one wrapping around to point 0 when 'closed'.
+// With SSE, four segments are processed at once. Same operations as IM_NORMALIZE2F_OVER_ZERO() (exact square root and division), so the output is identical.
+static void ImPolylineComputeNormals(const ImVec2* points, const int points_count, bool closed, ImVec2* out_normals)
+{
+    const int count = closed ? points_count : points_count - 1;
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 zero4 = _mm_setzero_ps();
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    const __m128 sign4 = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const float* p = &points[i1].x;
+        const __m128 d01 = _mm_sub_ps(_mm_loadu_ps(p + 2), _mm_loadu_ps(p + 0));    // dx0 dy0 dx1 dy1
+        const __m128 d23 = _mm_sub_ps(_mm_loadu_ps(p + 6), _mm_loadu_ps(p + 4));    // dx2 dy2 dx3 dy3
+        __m128 dx = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 inv_len = _mm_div_ps(one4, _mm_sqrt_ps(d2));
+        const __m128 over_zero = _mm_cmpgt_ps(d2, zero4);
+        const __m128 scale = _mm_or_ps(_mm_and_ps(over_zero, inv_len), _mm_andnot_ps(over_zero, one4));
+        dx = _mm_xor_ps(_mm_mul_ps(dx, scale), sign4);
+        dy = _mm_mul_ps(dy, scale);
+        _mm_storeu_ps(&out_normals[i1].x, _mm_unpacklo_ps(dy, dx));                 // (dy, -dx) for segments 0 and 1
+        _mm_storeu_ps(&out_normals[i1 + 2].x, _mm_unpackhi_ps(dy, dx));             // (dy, -dx) for segments 2 and 3
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Offset each point of a polyline along the average of its two adjacent segment normals, once per entry of 'offsets':
+// out_points[i * offsets_count + n] = points[i] + normal * offsets[n]. Point 0 is only written when 'closed' (its previous segment is then the last one).
+// With SSE, two points are processed at once. Same operations as IM_FIXNORMAL2F(), so the output is identical.
+static void ImPolylineComputeOffsetPoints(const ImVec2* points, const ImVec2* normals, const int points_count, bool closed, const float* offsets, const int offsets_count, ImVec2* out_points)
+{
+    int i2 = 1;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    for (; i2 + 1 < points_count; i2 += 2)
+    {
+        __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[i2 - 1].x), _mm_loadu_ps(&normals[i2].x)), half4); // x0 y0 x1 y1
+        const __m128 sq = _mm_mul_ps(dm, dm);
+        const __m128 d2 = _mm_max_ps(half4, _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))));   // Same as "if (d2 < 0.5f) d2 = 0.5f"
+        dm = _mm_mul_ps(dm, _mm_div_ps(_mm_set1_ps(1.0f), d2));
+        const __m128 p = _mm_loadu_ps(&points[i2].x);
+        for (int n = 0; n < offsets_count; n++)
+        {
+            const __m128 out = _mm_add_ps(p, _mm_mul_ps(dm, _mm_set1_ps(offsets[n])));
+            _mm_storel_pi((__m64*)(void*)&out_points[i2 * offsets_count + n], out);
+            _mm_storeh_pi((__m64*)(void*)&out_points[(i2 + 1) * offsets_count + n], out);
+        }
+    }
+#endif
+    for (int i = closed ? 0 : i2; i < points_count; i = (i == 0) ? i2 : i + 1)
+    {
+        const int i1 = (i == 0) ? points_count - 1 : i - 1;
+        float dm_x = (normals[i1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        for (int n = 0; n < offsets_count; n++)
+        {
+            out_points[i * offsets_count + n].x = points[i].x + dm_x * offsets[n];
+            out_points[i * offsets_count + n].y = points[i].y + dm_y * offsets[n];
+        }
+    }
+}
+
+// Write the indices of the 'count' segments of a polyline whose points each have 'stride' consecutive vertices starting at 'idx_base'.
+// 'pattern' lists the indices of one segment relative to its first vertex: values >= stride refer to the vertices of the segment's second point,
+// which for the final segment of a closed line are the vertices of point 0. With SSE, the indices of a segment are written with a few vector stores.
+static ImDrawIdx* ImPolylineWriteIndices(ImDrawIdx* idx_write, unsigned int idx_base, const int count, bool closed, const ImU8* pattern, const int pattern_count, const int stride)
+{
+    const int count_no_wrap = closed ? count - 1 : count;
+    unsigned int idx1 = idx_base;
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    IM_ASSERT(pattern_count <= 24 && (pattern_count & 1) == 0);
+    const int lanes = 16 / (int)sizeof(ImDrawIdx);
+    ImDrawIdx pattern_idx[24];
+    for (int n = 0; n < pattern_count; n++)
+        pattern_idx[n] = (ImDrawIdx)pattern[n];
+    for (; i1 < count_no_wrap; i1++, idx1 += stride, idx_write += pattern_count)
+    {
+        const __m128i base = (sizeof(ImDrawIdx) == 2) ? _mm_set1_epi16((short)idx1) : _mm_set1_epi32((int)idx1);
+        int n = 0;
+        for (; n + lanes <= pattern_count; n += lanes)
+        {
+            const __m128i offsets = _mm_loadu_si128((const __m128i*)(const void*)&pattern_idx[n]);
+            _mm_storeu_si128((__m128i*)(void*)&idx_write[n], (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(base, offsets) : _mm_add_epi32(base, offsets));
+        }
+        if (n + lanes / 2 <= pattern_count)
+        {
+            const __m128i offsets = _mm_loadl_epi64((const __m128i*)(const void*)&pattern_idx[n]);
+            _mm_storel_epi64((__m128i*)(void*)&idx_write[n], (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(base, offsets) : _mm_add_epi32(base, offsets));
+            n += lanes / 2;
+        }
+        if (n < pattern_count) // Two 16-bit indices left
+        {
+            int idx_pair;
+            memcpy(&idx_pair, &pattern_idx[n], sizeof(idx_pair));
+            idx_pair = _mm_cvtsi128_si32(_mm_add_epi16(base, _mm_cvtsi32_si128(idx_pair)));
+            memcpy(&idx_write[n], &idx_pair, sizeof(idx_pair));
+        }
+    }
+#endif
+    for (; i1 < count; i1++, idx1 += stride, idx_write += pattern_count)
+    {
+        const unsigned int idx2 = (i1 == count_no_wrap) ? idx_base : idx1 + stride; // Vertex index for end of segment
+        for (int n = 0; n < pattern_count; n++)
+            idx_write[n] = (ImDrawIdx)(pattern[n] < stride ? idx1 + pattern[n] : idx2 + pattern[n] - stride);
+    }
+    return idx_write;
+}
+
+// Write the indices of a triangle fan over the 'points_count' points of a convex polygon, whose vertices are 'stride' apart starting at 'idx_base':
+// triangle (0, i - 1, i) for each i in 2..points_count-1. With SSE, four triangles are written at once.
+static ImDrawIdx* ImPolygonWriteFanIndices(ImDrawIdx* idx_write, unsigned int idx_base, const int points_count, const int stride)
+{
+    int i = 2;
+#ifdef IMGUI_ENABLE_SSE
+    if (points_count >= 6)
+    {
+        // Indices of the first four triangles, and how much they advance for each following group of four
+        ImDrawIdx group_idx[12], group_step[12];
+        for (int n = 0; n < 12; n++)
+        {
+            const int corner = n % 3;
+            group_idx[n] = (ImDrawIdx)(idx_base + (corner == 0 ? 0 : (n / 3 + corner) * stride));
+            group_step[n] = (ImDrawIdx)(corner == 0 ? 0 : 4 * stride);
+        }
+        __m128i idx[3], step[3]; // 12 indices: 8 + 4 with 16-bit indices, 4 + 4 + 4 with 32-bit indices
+        for (int v = 0, n = 0; n < 12; v++, n += 16 / (int)sizeof(ImDrawIdx))
+        {
+            idx[v] = (n + 8 <= 12 || sizeof(ImDrawIdx) == 4) ? _mm_loadu_si128((const __m128i*)(const void*)&group_idx[n]) : _mm_loadl_epi64((const __m128i*)(const void*)&group_idx[n]);
+            step[v] = (n + 8 <= 12 || sizeof(ImDrawIdx) == 4) ? _mm_loadu_si128((const __m128i*)(const void*)&group_step[n]) : _mm_loadl_epi64((const __m128i*)(const void*)&group_step[n]);
+        }
+        for (; i + 3 < points_count; i += 4, idx_write += 12)
+        {
+            if (sizeof(ImDrawIdx) == 2)
+            {
+                _mm_storeu_si128((__m128i*)(void*)idx_write, idx[0]);
+                _mm_storel_epi64((__m128i*)(void*)(idx_write + 8), idx[1]);
+                idx[0] = _mm_add_epi16(idx[0], step[0]);
+                idx[1] = _mm_add_epi16(idx[1], step[1]);
+            }
+            else
+            {
+                for (int v = 0; v < 3; v++)
+                {
+                    _mm_storeu_si128((__m128i*)(void*)(idx_write + v * 4), idx[v]);
+                    idx[v] = _mm_add_epi32(idx[v], step[v]);
+                }
+            }
+        }
+    }
+#endif
+    for (; i < points_count; i++, idx_write += 3)
+    {
+        idx_write[0] = (ImDrawIdx)(idx_base); idx_write[1] = (ImDrawIdx)(idx_base + (i - 1) * stride); idx_write[2] = (ImDrawIdx)(idx_base + i * stride);
+    }
+    return idx_write;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
@@ -684,6 +990,48 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     if (points_count < 2)
         return;
 
+#ifndef IMGUI_DISABLE_DRAWLIST_CULLING
+    // Skip lines entirely outside of the clipping rectangle. An open line crossing its edges (e.g. a long plot scrolled or zoomed in) is split in runs of
+    // visible segments. Each run is extended by the first culled segment on either side, so its last visible points keep the joins of the unsplit line:
+    // only the added end points get a cap instead of a join, and both points of a culled segment are further from the same edge than their geometry extends.
+    {
+        const ImVec4& cr = ImDrawListGetCullRect(this);
+        const float margin = ImDrawListStrokeMargin(thickness);
+        ImVec2 bb_min, bb_max;
+        ImPolylineComputeBoundingBox(points, points_count, &bb_min, &bb_max);
+        if (ImDrawListIsClippedOut(this, bb_min, bb_max, margin))
+            return;
+        if (!closed && (bb_min.x - margin < cr.x || bb_min.y - margin < cr.y || bb_max.x + margin > cr.z || bb_max.y + margin > cr.w))
+        {
+            // Gaps shorter than IM_DRAWLIST_POLYLINE_MIN_CULLED_SEGMENTS are cheaper to draw than to start a new run after.
+            int run_start = 0;
+            for (int i1 = ImPolylineFindSegment(points, 0, points_count, cr, margin, true); i1 < points_count - 1; )
+            {
+                const int gap_end = ImPolylineFindSegment(points, i1 + 1, points_count, cr, margin, false);
+                if (gap_end - i1 >= IM_DRAWLIST_POLYLINE_MIN_CULLED_SEGMENTS || gap_end == points_count - 1)
+                {
+                    if (i1 > run_start)
+                        _AddPolyline(points + run_start, i1 - run_start + 2, col, false, thickness);
+                    run_start = (gap_end < points_count - 1) ? gap_end - 1 : gap_end;
+                }
+                i1 = ImPolylineFindSegment(points, gap_end, points_count, cr, margin, true);
+            }
+            if (run_start > 0)
+            {
+                if (run_start < points_count - 1)
+                    _AddPolyline(points + run_start, points_count - run_start, col, false, thickness);
+                return;
+            }
+        }
+    }
+#endif
+
+    _AddPolyline(points, points_count, col, closed, thickness);
+}
+
+// Stroke without clipping rectangle tests, called by AddPolyline() for the whole line or each of its visible runs
+void ImDrawList::_AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+{
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
     const bool thick_line = (thickness > 1.0f);
@@ -705,7 +1053,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)));
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
@@ -717,15 +1065,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        ImPolylineComputeNormals(points, points_count, closed, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
@@ -742,57 +1082,26 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
+            // If line is not closed, the first point needs to be generated differently as there are no normals to blend
             if (!closed)
             {
                 temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
                 temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                if (use_texture)
-                {
-                    // Add indices for two triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
-                    _IdxWritePtr += 6;
-                }
-                else
-                {
-                    // Add indexes for four triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
-                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
-                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
-                    _IdxWritePtr += 12;
-                }
+            // Add temporary vertexes for the outer edges, offsetting each point by the average of its adjacent normals
+            // (the first point in a closed line being generated from the final normal)
+            const float edge_offsets[2] = { half_draw_size, -half_draw_size }; // Offsets to the outer edges of the AA area
+            ImPolylineComputeOffsetPoints(points, temp_normals, points_count, closed, edge_offsets, 2, temp_points);
 
-                idx1 = idx2;
-            }
+            // Generate the indices to form a number of triangles for each line segment [n, n+1], the final segment of a closed line wrapping to the first point
+            // Vertices are laid out per point as (left, right) with a texture, or (center, left, right) without
+            static const ImU8 indices_texture[6] = { 2, 0, 1, 3, 1, 2 };                   // Right tri, Left tri
+            static const ImU8 indices_no_texture[12] = { 3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4 }; // Right tri 1 & 2, Left tri 1 & 2
+            if (use_texture)
+                _IdxWritePtr = ImPolylineWriteIndices(_IdxWritePtr, _VtxCurrentIdx, count, closed, indices_texture, 6, 2);
+            else
+                _IdxWritePtr = ImPolylineWriteIndices(_IdxWritePtr, _VtxCurrentIdx, count, closed, indices_no_texture, 12, 3);
 
             // Add vertexes for each point on the line
             if (use_texture)
@@ -833,60 +1142,24 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
+            // If line is not closed, the first point needs to be generated differently as there are no normals to blend
             if (!closed)
             {
-                const int points_last = points_count - 1;
                 temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
                 temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
                 temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
                 temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
-            }
+            // Add temporary vertices, offsetting each point by the average of its adjacent normals
+            // (the first point in a closed line being generated from the final normal)
+            const float edge_offsets[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            ImPolylineComputeOffsetPoints(points, temp_normals, points_count, closed, edge_offsets, 4, temp_points);
+
+            // Generate the indices to form a number of triangles for each line segment [n, n+1], the final segment of a closed line wrapping to the first point
+            // Vertices are laid out per point as (outer left, inner left, inner right, outer right)
+            static const ImU8 indices_thick[18] = { 5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6 };
+            _IdxWritePtr = ImPolylineWriteIndices(_IdxWritePtr, _VtxCurrentIdx, count, closed, indices_thick, 18, 4);
 
             // Add vertices
             for (int i = 0; i < points_count; i++)
@@ -919,10 +1192,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = ImVec2(p1.x + dy, p1.y - dx); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = ImVec2(p2.x + dy, p2.y - dx); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = ImVec2(p2.x - dy, p2.y + dx); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = ImVec2(p1.x - dy, p1.y + dx); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -939,6 +1212,13 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     if (points_count < 3)
         return;
 
+#ifndef IMGUI_DISABLE_DRAWLIST_CULLING
+    ImVec2 bb_min, bb_max;
+    ImPolylineComputeBoundingBox(points, points_count, &bb_min, &bb_max);
+    if (ImDrawListIsClippedOut(this, bb_min, bb_max, 1.0f))
+        return;
+#endif
+
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
     if (Flags & ImDrawListFlags_AntiAliasedFill)
@@ -953,46 +1233,29 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
-        for (int i = 2; i < points_count; i++)
-        {
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
-            _IdxWritePtr += 3;
-        }
+        _IdxWritePtr = ImPolygonWriteFanIndices(_IdxWritePtr, vtx_inner_idx, points_count, 2);
 
-        // Compute normals
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        // Compute normals, then offset each point by the average of its adjacent normals
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * 3 * sizeof(ImVec2)); //-V630
+        ImVec2* temp_points = temp_normals + points_count;
+        const float fringe_offsets[2] = { -AA_SIZE * 0.5f, AA_SIZE * 0.5f }; // Inner, Outer
+        ImPolylineComputeNormals(points, points_count, true, temp_normals);
+        ImPolylineComputeOffsetPoints(points, temp_normals, points_count, true, fringe_offsets, 2, temp_points);
 
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        // Add vertices
+        for (int i = 0; i < points_count; i++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
-
-            // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
-
-            // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
-            _IdxWritePtr += 6;
         }
+
+        // Add indexes for fringes, starting with the edge from the last point to the first one
+        const int i_last = points_count - 1;
+        _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i_last << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i_last << 1));
+        _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i_last << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx);
+        static const ImU8 indices_fringe[6] = { 2, 0, 1, 1, 3, 2 };
+        _IdxWritePtr = ImPolylineWriteIndices(_IdxWritePtr + 6, vtx_inner_idx, points_count - 1, false, indices_fringe, 6, 2);
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
@@ -1006,11 +1269,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        for (int i = 2; i < points_count; i++)
-        {
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + i - 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + i);
-            _IdxWritePtr += 3;
-        }
+        _IdxWritePtr = ImPolygonWriteFanIndices(_IdxWritePtr, _VtxCurrentIdx, points_count, 1);
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
 }
@@ -1134,7 +1393,7 @@ void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDr
 
 void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p1, p2), ImMax(p1, p2), ImDrawListStrokeMargin(thickness)))
         return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
@@ -1145,7 +1404,7 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
 // Note we don't render 1 pixels sized rectangles properly.
 void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p_min, p_max), ImMax(p_min, p_max), ImDrawListStrokeMargin(thickness)))
         return;
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, rounding_corners);
@@ -1156,7 +1415,7 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 
 void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p_min, p_max), ImMax(p_min, p_max), 1.0f))
         return;
     if (rounding > 0.0f)
     {
@@ -1173,7 +1432,7 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 // p_min = upper-left, p_max = lower-right
 void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left)
 {
-    if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
+    if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p_min, p_max), ImMax(p_min, p_max), 1.0f))
         return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
@@ -1188,7 +1447,7 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 
 void ImDrawList::AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), ImDrawListStrokeMargin(thickness)))
         return;
 
     PathLineTo(p1);
@@ -1200,7 +1459,7 @@ void ImDrawList::AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, c
 
 void ImDrawList::AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 1.0f))
         return;
 
     PathLineTo(p1);
@@ -1212,7 +1471,7 @@ void ImDrawList::AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2&
 
 void ImDrawList::AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), ImDrawListStrokeMargin(thickness)))
         return;
 
     PathLineTo(p1);
@@ -1223,7 +1482,7 @@ void ImDrawList::AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
 
 void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), 1.0f))
         return;
 
     PathLineTo(p1);
@@ -1234,7 +1493,7 @@ void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImV
 
 void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f || ImDrawListIsClippedOut(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), ImDrawListStrokeMargin(thickness)))
         return;
 
     // Obtain segment count
@@ -1264,7 +1523,7 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 
 void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f || ImDrawListIsClippedOut(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), 1.0f))
         return;
 
     // Obtain segment count
@@ -1295,7 +1554,7 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2 || ImDrawListIsClippedOut(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), ImDrawListStrokeMargin(thickness)))
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
@@ -1307,7 +1566,7 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2 || ImDrawListIsClippedOut(this, center - ImVec2(radius, radius), center + ImVec2(radius, radius), 1.0f))
         return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
@@ -1319,7 +1578,7 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 // Cubic Bezier takes 4 controls points
 void ImDrawList::AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), ImDrawListStrokeMargin(thickness)))
         return;
 
     PathLineTo(p1);
@@ -1363,7 +1622,7 @@ void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, c
 
 void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p_min, p_max), ImMax(p_min, p_max), 0.0f))
         return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
@@ -1379,7 +1638,7 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 
 void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& uv1, const ImVec2& uv2, const ImVec2& uv3, const ImVec2& uv4, ImU32 col)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 0.0f))
         return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
@@ -1395,7 +1654,7 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 
 void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
+    if ((col & IM_COL32_A_MASK) == 0 || ImDrawListIsClippedOut(this, ImMin(p_min, p_max), ImMax(p_min, p_max), 1.0f))
         return;
 
     if (rounding <= 0.0f || (rounding_corners & ImDrawCornerFlags_All) == 0)
@@ -1480,11 +1739,13 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes.
+    // The first command of a channel is merged into the last command of the previous channel when their settings match (which is
+    // the common case for the table column channels grouped by TableReorderDrawChannelsForMerge()). Rather than being erased from
+    // its channel, a merged command is emptied and skipped when copying.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
@@ -1492,40 +1753,47 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
         // Equivalent of PopUnusedDrawCmd() for this channel's cmdbuffer and except we don't need to test for UserCallback.
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0)
             ch._CmdBuffer.pop_back();
+        if (ch._CmdBuffer.Size == 0)
+            continue;
 
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
+        if (last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
         {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
+            // Merge previous channel last draw command with current channel first draw command if matching.
+            last_cmd->ElemCount += next_cmd->ElemCount;
+            next_cmd->ElemCount = 0;
+            new_cmd_buffer_count--;
+            if (ch._CmdBuffer.Size == 1)
+                continue;
         }
+        last_cmd = &ch._CmdBuffer.back();
     }
+    ImDrawCmd* host_last_cmd = (draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
+    int idx_offset = host_last_cmd ? host_last_cmd->IdxOffset + host_last_cmd->ElemCount : 0; // Includes commands merged into it
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+    // Write commands with their final IdxOffset, and indices in order (they are fairly small structures, we don't copy vertices only indices)
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = ch._CmdBuffer.Data[cmd_n];
+            if (cmd_n == 0 && cmd.ElemCount == 0 && cmd.UserCallback == NULL)
+                continue;
+            *cmd_write = cmd;
+            cmd_write->IdxOffset = idx_offset;
+            idx_offset += cmd.ElemCount;
+            cmd_write++;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    IM_ASSERT(cmd_write == draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size);
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -1583,10 +1851,51 @@ void ImDrawData::DeIndexAllBuffers()
             new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
+        cmd_list->_ContentHash = 0;
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
 
+// Hash of the data a renderer reads from a draw list: vertices, indices and commands.
+// ImDrawCmd may contain padding, so commands are hashed field by field.
+static ImU32 ImDrawList_CalcContentHash(const ImDrawList* draw_list)
+{
+    ImU32 hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+    hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+    for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_i];
+        hash = ImHashData(cmd, IM_OFFSETOF(ImDrawCmd, VtxOffset) + sizeof(unsigned int), hash); // ClipRect, TextureId, VtxOffset
+        hash = ImHashData(&cmd->IdxOffset, sizeof(unsigned int), hash);
+        hash = ImHashData(&cmd->ElemCount, sizeof(unsigned int), hash);
+        hash = ImHashData(&cmd->UserCallback, sizeof(ImDrawCallback), hash);
+        hash = ImHashData(&cmd->UserCallbackData, sizeof(void*), hash);
+    }
+    return (hash != 0) ? hash : 1; // 0 is reserved for 'not computed'
+}
+
+// Combine the cached hash of each draw list with the display rectangle.
+// Lists kept from the previous frame (see ImGui::SetNextWindowContentVersion()) still hold their hash, so an idle frame mostly hashes small lists.
+ImU32 ImDrawData::GetContentHash()
+{
+    ImU32 hash = ImHashData(&DisplayPos, sizeof(DisplayPos));
+    hash = ImHashData(&DisplaySize, sizeof(DisplaySize), hash);
+    hash = ImHashData(&FramebufferScale, sizeof(FramebufferScale), hash);
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        if (cmd_list->_ContentHash == 0 || cmd_list->_ContentHashVtxCount != cmd_list->VtxBuffer.Size || cmd_list->_ContentHashIdxCount != cmd_list->IdxBuffer.Size || cmd_list->_ContentHashCmdCount != cmd_list->CmdBuffer.Size)
+        {
+            cmd_list->_ContentHash = ImDrawList_CalcContentHash(cmd_list);
+            cmd_list->_ContentHashVtxCount = cmd_list->VtxBuffer.Size;
+            cmd_list->_ContentHashIdxCount = cmd_list->IdxBuffer.Size;
+            cmd_list->_ContentHashCmdCount = cmd_list->CmdBuffer.Size;
+        }
+        hash = ImHashData(&cmd_list->_ContentHash, sizeof(ImU32), hash);
+    }
+    return hash;
+}
+
 // Helper to scale the ClipRect field of each ImDrawCmd.
 // Use if your final output buffer is at a different scale than draw_data->DisplaySize,
 // or if there is a difference between your window resolution and framebuffer resolution.
@@ -1595,6 +1904,7 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
+        cmd_list->_ContentHash = 0;
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
@@ -1647,12 +1957,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(vertex->pos - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(vertex->pos - a, scale);
     }
 }
 
@@ -1735,6 +2045,35 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(91,0), ImVec2(17,22), ImVec2( 5, 0) }, // ImGuiMouseCursor_Hand
 };
 
+// Height of the virtual canvas we pack into. The texture itself is only as high as what got packed.
+static const int IM_FONTATLAS_TEX_HEIGHT_MAX = 1024 * 32;
+
+// Build() rasterizes glyphs in jobs of up to this many glyphs of a same source font, spread over ImFontAtlas::BuildThreadsCount threads
+static const int IM_FONTATLAS_BUILD_GLYPHS_PER_JOB = 64;
+
+// With ImFontAtlasFlags_DynamicGlyphs, codepoints up to this one are still rasterized by Build()
+static const unsigned int IM_FONTATLAS_DYNAMIC_GLYPHS_EAGER_LAST = 0xFF;
+
+// Data kept after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontAtlasDynamicData
+{
+    stbtt_pack_context          PackContext;    // Packer state left by Build(). Our pixels pointer/height in there are updated before each use.
+    ImVector<stbtt_fontinfo>    FontInfos;      // One per atlas->ConfigData[], pointing into the TTF data
+
+    ImFontAtlasDynamicData()    { memset(&PackContext, 0, sizeof(PackContext)); }
+};
+
+void ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    if (dynamic_data == NULL)
+        return;
+    if (dynamic_data->PackContext.pack_info)
+        stbtt_PackEnd(&dynamic_data->PackContext);
+    IM_DELETE(dynamic_data);
+    atlas->DynamicData = NULL;
+}
+
 ImFontAtlas::ImFontAtlas()
 {
     Locked = false;
@@ -1742,12 +2081,18 @@ ImFontAtlas::ImFontAtlas()
     TexID = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    TexSdfSpread = 4;
+    BuildThreadsCount = 0;
+    BuildCacheFilename = NULL;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexWidth = TexHeight = 0;
     TexUvScale = ImVec2(0.0f, 0.0f);
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    TexDirtyX0 = TexDirtyY0 = TexDirtyX1 = TexDirtyY1 = 0;
+    TexGlyphsGeneration = 0;
+    DynamicData = NULL;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -1760,6 +2105,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicData(this);
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -1782,6 +2128,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicData(this);
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -1823,6 +2170,7 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -1847,6 +2195,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -1916,6 +2265,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
@@ -1951,6 +2301,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -1973,6 +2324,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
     ImFontAtlasCustomRect r;
@@ -1984,6 +2336,7 @@ int ImFontAtlas::AddCustomRectRegular(int width, int height)
 
 int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
 #ifdef IMGUI_USE_WCHAR32
     IM_ASSERT(id <= IM_UNICODE_CODEPOINT_MAX);
 #endif
@@ -2032,8 +2385,20 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    return ImFontAtlasBuildWithStbTruetype(this);
+    if (BuildCacheFilename == NULL || ConfigData.Size == 0)
+        return ImFontAtlasBuildWithStbTruetype(this);
+
+    // Reuse the output of a previous identical build, or build and save it for next time
+    ImFontAtlasBuildInit(this);
+    const ImU32 key = ImFontAtlasBuildCalcCacheKey(this);
+    if (ImFontAtlasBuildLoadCache(this, BuildCacheFilename, key))
+        return true;
+    if (!ImFontAtlasBuildWithStbTruetype(this))
+        return false;
+    ImFontAtlasBuildSaveCache(this, BuildCacheFilename, key);
+    return true;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2078,6 +2443,151 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Size of the packed rectangle of a glyph, including atlas->TexGlyphPadding (this is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildCalcGlyphRectSize(ImFontAtlas* atlas, const ImFontConfig& cfg, const stbtt_fontinfo* font_info, float scale, int codepoint, stbrp_rect* r)
+{
+    int x0, y0, x1, y1;
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoint);
+    IM_ASSERT(glyph_index_in_font != 0);
+    const int padding = atlas->TexGlyphPadding;
+    if (atlas->Flags & ImFontAtlasFlags_SDF)
+    {
+        // Same box as stbtt_GetGlyphSDF(): no oversampling, extended by the distance spread on each side
+        stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+        const int spread = (x0 != x1 && y0 != y1) ? atlas->TexSdfSpread : 0;
+        r->w = (stbrp_coord)(x1 - x0 + spread * 2 + padding);
+        r->h = (stbrp_coord)(y1 - y0 + spread * 2 + padding);
+        return;
+    }
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    r->w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    r->h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+}
+
+// Render the glyphs of 'pack_range' into their packed rectangles and fill its chardata_for_range[].
+// Same as stbtt_PackFontRangesRenderIntoRects(), plus the ImFontAtlasFlags_SDF mode and the RasterizerMultiply operator.
+// Like stbtt_PackFontRangesRenderIntoRects(), this moves the rectangles by atlas->TexGlyphPadding so they only cover the glyph pixels.
+static void ImFontAtlasBuildRenderGlyphRects(ImFontAtlas* atlas, stbtt_pack_context* spc, const ImFontConfig& cfg, const stbtt_fontinfo* font_info, stbtt_pack_range* pack_range, stbrp_rect* rects)
+{
+    if (atlas->Flags & ImFontAtlasFlags_SDF)
+    {
+        // Distances are stored as 128 +/- 128 * distance / TexSdfSpread, so the glyph edge is at 0.5 once normalized
+        const float scale = (pack_range->font_size > 0) ? stbtt_ScaleForPixelHeight(font_info, pack_range->font_size) : stbtt_ScaleForMappingEmToPixels(font_info, -pack_range->font_size);
+        const int spread = atlas->TexSdfSpread;
+        const stbrp_coord pad = (stbrp_coord)atlas->TexGlyphPadding;
+        for (int glyph_i = 0; glyph_i < pack_range->num_chars; glyph_i++)
+        {
+            stbrp_rect* r = &rects[glyph_i];
+            stbtt_packedchar* bc = &pack_range->chardata_for_range[glyph_i];
+            if (!r->was_packed || r->w == 0 || r->h == 0)
+                continue;
+            r->x += pad;
+            r->y += pad;
+            r->w -= pad;
+            r->h -= pad;
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, pack_range->array_of_unicode_codepoints[glyph_i]);
+            int advance, lsb, w = 0, h = 0, x_off = 0, y_off = 0;
+            stbtt_GetGlyphHMetrics(font_info, glyph_index_in_font, &advance, &lsb);
+            unsigned char* sdf = stbtt_GetGlyphSDF(font_info, scale, glyph_index_in_font, spread, 128, 128.0f / spread, &w, &h, &x_off, &y_off);
+            if (sdf != NULL)
+            {
+                IM_ASSERT(w == r->w && h == r->h);
+                for (int y = 0; y < h; y++)
+                    memcpy(spc->pixels + (r->y + y) * spc->stride_in_bytes + r->x, sdf + y * w, (size_t)w);
+                stbtt_FreeSDF(sdf, NULL);
+            }
+            bc->x0 = (stbtt_int16)r->x;
+            bc->y0 = (stbtt_int16)r->y;
+            bc->x1 = (stbtt_int16)(r->x + w);
+            bc->y1 = (stbtt_int16)(r->y + h);
+            bc->xadvance = scale * advance;
+            bc->xoff = (float)x_off;
+            bc->yoff = (float)y_off;
+            bc->xoff2 = (float)(x_off + w);
+            bc->yoff2 = (float)(y_off + h);
+        }
+        return;
+    }
+
+    stbtt_PackFontRangesRenderIntoRects(spc, font_info, pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = &rects[0];
+        for (int glyph_i = 0; glyph_i < pack_range->num_chars; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, spc->pixels, r->x, r->y, r->w, r->h, spc->stride_in_bytes);
+    }
+}
+
+// Rasterization work shared by the threads of ImFontAtlasBuildRenderGlyphs()
+struct ImFontBuildRenderJob
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and src_tmp_array[]
+    int                 GlyphsStart;        // First glyph of the job within the source font GlyphsList[]
+    int                 GlyphsCount;
+};
+
+struct ImFontBuildRenderData
+{
+    ImFontAtlas*                    Atlas;
+    ImFontBuildSrcData*             SrcTmpArray;
+    const stbtt_pack_context*       PackContext;
+    ImVector<ImFontBuildRenderJob>  Jobs;
+    std::atomic<int>                NextJob;
+};
+
+static void ImFontAtlasBuildRenderGlyphsWorker(ImFontBuildRenderData* data)
+{
+    // stbtt_PackFontRangesRenderIntoRects() temporarily writes the oversampling into the pack context: use our own copy.
+    // Rectangles of different glyphs don't overlap, so jobs can write into the texture concurrently.
+    ImFontAtlas* atlas = data->Atlas;
+    stbtt_pack_context spc = *data->PackContext;
+    for (int job_i = data->NextJob++; job_i < data->Jobs.Size; job_i = data->NextJob++)
+    {
+        const ImFontBuildRenderJob& job = data->Jobs[job_i];
+        ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+        ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job.SrcIndex];
+        stbtt_pack_range pack_range = src_tmp.PackRange;
+        pack_range.array_of_unicode_codepoints += job.GlyphsStart;
+        pack_range.chardata_for_range += job.GlyphsStart;
+        pack_range.num_chars = job.GlyphsCount;
+        ImFontAtlasBuildRenderGlyphRects(atlas, &spc, cfg, &src_tmp.FontInfo, &pack_range, src_tmp.Rects + job.GlyphsStart);
+    }
+}
+
+// Render packed glyphs of all source fonts into the texture, using up to atlas->BuildThreadsCount threads.
+// The output doesn't depend on the number of threads: packing is already done and each glyph only writes to its own rectangle.
+static void ImFontAtlasBuildRenderGlyphs(ImFontAtlas* atlas, ImVector<ImFontBuildSrcData>& src_tmp_array, const stbtt_pack_context* spc)
+{
+    ImFontBuildRenderData data;
+    data.Atlas = atlas;
+    data.SrcTmpArray = src_tmp_array.Data;
+    data.PackContext = spc;
+    data.NextJob = 0;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += IM_FONTATLAS_BUILD_GLYPHS_PER_JOB)
+        {
+            ImFontBuildRenderJob job = { src_i, glyph_i, ImMin(IM_FONTATLAS_BUILD_GLYPHS_PER_JOB, src_tmp_array[src_i].GlyphsCount - glyph_i) };
+            data.Jobs.push_back(job);
+        }
+
+    int threads_count = (atlas->BuildThreadsCount > 0) ? atlas->BuildThreadsCount : (int)std::thread::hardware_concurrency();
+    threads_count = ImClamp(threads_count, 1, ImMax(data.Jobs.Size, 1));
+    ImVector<std::thread*> threads;
+    for (int thread_n = 1; thread_n < threads_count; thread_n++)
+        threads.push_back(IM_NEW(std::thread)(ImFontAtlasBuildRenderGlyphsWorker, &data));
+    ImFontAtlasBuildRenderGlyphsWorker(&data);
+    for (int thread_n = 0; thread_n < threads.Size; thread_n++)
+    {
+        threads[thread_n]->join();
+        IM_DELETE(threads[thread_n]);
+    }
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2102,6 +2612,15 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     atlas->ClearTexData();
+    atlas->ClearTexDataDirtyRect();
+
+    // With dynamic glyphs, keep the font infos and the packer around after the build
+    ImFontAtlasDynamicData* dynamic_data = NULL;
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        dynamic_data = atlas->DynamicData = IM_NEW(ImFontAtlasDynamicData)();
+        dynamic_data->FontInfos.resize(atlas->ConfigData.Size);
+    }
 
     // Temporary storage for building
     ImVector<ImFontBuildSrcData> src_tmp_array;
@@ -2132,6 +2651,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         IM_ASSERT(font_offset >= 0 && "FontData is incorrect, or FontNo cannot be found.");
         if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
             return false;
+        if (dynamic_data)
+            dynamic_data->FontInfos[src_i] = src_tmp.FontInfo;
 
         // Measure highest codepoints
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
@@ -2155,6 +2676,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
             for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
             {
+                if (dynamic_data && codepoint > IM_FONTATLAS_DYNAMIC_GLYPHS_EAGER_LAST) // Rasterized on demand, see step 10.
+                    break;
                 if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
@@ -2218,15 +2741,9 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            ImFontAtlasBuildCalcGlyphRectSize(atlas, cfg, &src_tmp.FontInfo, scale, src_tmp.GlyphsList[glyph_i], &src_tmp.Rects[glyph_i]);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2239,13 +2756,12 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : dynamic_data ? 1024 : 512; // Leave room for glyphs added later
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
-    const int TEX_HEIGHT_MAX = 1024 * 32;
     stbtt_pack_context spc = {};
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, IM_FONTATLAS_TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
     ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
@@ -2273,37 +2789,22 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    ImFontAtlasBuildRenderGlyphs(atlas, src_tmp_array, &spc);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
-    }
+        src_tmp_array[src_i].Rects = NULL;
 
-    // End packing
-    stbtt_PackEnd(&spc);
+    // End packing (dynamic glyphs carry on packing below what we packed so far)
+    if (dynamic_data)
+        dynamic_data->PackContext = spc;
+    else
+        stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 && !dynamic_data) // With dynamic glyphs, sources with no glyph yet still need their font to be set up
             continue;
 
         // When merging fonts with MergeMode=true:
@@ -2334,6 +2835,26 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    // 10. Register the codepoints of the requested ranges left for on-demand rasterization
+    // We don't check whether the font has them yet: this is left to BuildPendingGlyphs() as only few will ever be requested.
+    if (dynamic_data)
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            ImFont* dst_font = atlas->ConfigData[src_i].DstFont;
+            if (src_tmp.GlyphsHighest <= (int)IM_FONTATLAS_DYNAMIC_GLYPHS_EAGER_LAST)
+                continue;
+            const int words_count = (src_tmp.GlyphsHighest + 32) >> 5;
+            if (dst_font->DynamicGlyphsAvailable.Size < words_count)
+            {
+                dst_font->DynamicGlyphsAvailable.resize(words_count, 0);
+                dst_font->DynamicGlyphsPending.resize(words_count, 0);
+            }
+            for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
+                for (unsigned int codepoint = ImMax((unsigned int)src_range[0], (unsigned int)IM_FONTATLAS_DYNAMIC_GLYPHS_EAGER_LAST + 1); codepoint <= src_range[1]; codepoint++)
+                    dst_font->DynamicGlyphsAvailable[codepoint >> 5] |= (ImU32)1 << (codepoint & 31);
+        }
+
     // Cleanup temporary (ImVector doesn't honor destructor)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
         src_tmp_array[src_i].~ImFontBuildSrcData();
@@ -2342,6 +2863,543 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+// Extend the texture height to at least 'min_height', doubling it so the V coordinates already handed out can be rescaled exactly.
+// The whole texture becomes dirty, as its size changes.
+void ImFontAtlasBuildGrowTexture(ImFontAtlas* atlas, int min_height)
+{
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL && atlas->TexHeight > 0);
+    int new_height = atlas->TexHeight;
+    while (new_height < min_height)
+        new_height *= 2;
+    if (new_height == atlas->TexHeight)
+        return;
+
+    const size_t old_size = (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+    const size_t new_size = (size_t)atlas->TexWidth * (size_t)new_height;
+    unsigned char* new_pixels_alpha8 = (unsigned char*)IM_ALLOC(new_size);
+    memcpy(new_pixels_alpha8, atlas->TexPixelsAlpha8, old_size);
+    memset(new_pixels_alpha8 + old_size, 0, new_size - old_size);
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = new_pixels_alpha8;
+    if (atlas->TexPixelsRGBA32)
+    {
+        unsigned int* new_pixels_rgba32 = (unsigned int*)IM_ALLOC(new_size * 4);
+        memcpy(new_pixels_rgba32, atlas->TexPixelsRGBA32, old_size * 4);
+        for (size_t n = old_size; n < new_size; n++)
+            new_pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = new_pixels_rgba32;
+    }
+
+    // Rescale V coordinates: glyphs (including custom rect glyphs), white pixel and baked lines
+    const float v_scale = (float)atlas->TexHeight / (float)new_height;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        ImFont* font = atlas->Fonts[font_i];
+        for (int glyph_i = 0; glyph_i < font->Glyphs.Size; glyph_i++)
+        {
+            font->Glyphs[glyph_i].V0 *= v_scale;
+            font->Glyphs[glyph_i].V1 *= v_scale;
+        }
+    }
+    atlas->TexUvWhitePixel.y *= v_scale;
+    for (int n = 0; n < IM_ARRAYSIZE(atlas->TexUvLines); n++)
+    {
+        atlas->TexUvLines[n].y *= v_scale;
+        atlas->TexUvLines[n].w *= v_scale;
+    }
+    atlas->TexHeight = new_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexDirtyX0 = atlas->TexDirtyY0 = 0;
+    atlas->TexDirtyX1 = atlas->TexWidth;
+    atlas->TexDirtyY1 = atlas->TexHeight;
+}
+
+static bool ImFontAtlasBuildSrcRangesContain(const ImFontConfig& cfg, const ImFontAtlas* atlas, unsigned int codepoint)
+{
+    const ImWchar* src_range = cfg.GlyphRanges ? cfg.GlyphRanges : ((ImFontAtlas*)atlas)->GetGlyphRangesDefault();
+    for (; src_range[0] && src_range[1]; src_range += 2)
+        if (codepoint >= src_range[0] && codepoint <= src_range[1])
+            return true;
+    return false;
+}
+
+// Rasterize 'codepoints' from one source font into free atlas space, same as steps 4-9 of ImFontAtlasBuildWithStbTruetype()
+static int ImFontAtlasBuildDynamicGlyphsForSource(ImFontAtlas* atlas, int src_i, const ImVector<int>& codepoints)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    ImFontConfig& cfg = atlas->ConfigData[src_i];
+    ImFont* dst_font = cfg.DstFont;
+    const stbtt_fontinfo* font_info = &dynamic_data->FontInfos[src_i];
+
+    ImVector<stbrp_rect> rects;
+    ImVector<stbtt_packedchar> packed_chars;
+    rects.resize(codepoints.Size);
+    packed_chars.resize(codepoints.Size);
+    memset(rects.Data, 0, (size_t)rects.size_in_bytes());
+    memset(packed_chars.Data, 0, (size_t)packed_chars.size_in_bytes());
+
+    // Gather sizes and pack
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    for (int glyph_i = 0; glyph_i < codepoints.Size; glyph_i++)
+        ImFontAtlasBuildCalcGlyphRectSize(atlas, cfg, font_info, scale, codepoints[glyph_i], &rects[glyph_i]);
+    stbtt_pack_context& spc = dynamic_data->PackContext;
+    stbrp_pack_rects((stbrp_context*)spc.pack_info, rects.Data, rects.Size);
+    int tex_height_needed = 0;
+    for (int glyph_i = 0; glyph_i < rects.Size; glyph_i++)
+        if (rects[glyph_i].was_packed)
+            tex_height_needed = ImMax(tex_height_needed, rects[glyph_i].y + rects[glyph_i].h);
+    if (tex_height_needed > atlas->TexHeight)
+        ImFontAtlasBuildGrowTexture(atlas, tex_height_needed);
+
+    // Render
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = (int*)codepoints.Data;
+    pack_range.num_chars = codepoints.Size;
+    pack_range.chardata_for_range = packed_chars.Data;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.height = atlas->TexHeight;
+    ImFontAtlasBuildRenderGlyphRects(atlas, &spc, cfg, font_info, &pack_range, rects.Data);
+    spc.pixels = NULL;
+
+    // Register glyphs, update the RGBA32 copy and the dirty rectangle
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
+    int glyphs_added = 0;
+    for (int glyph_i = 0; glyph_i < codepoints.Size; glyph_i++)
+    {
+        const stbrp_rect& r = rects[glyph_i];
+        if (!r.was_packed)
+            continue;
+        if (atlas->TexPixelsRGBA32)
+            for (int y = r.y; y < r.y + r.h; y++)
+            {
+                const unsigned char* src = atlas->TexPixelsAlpha8 + y * atlas->TexWidth + r.x;
+                unsigned int* dst = atlas->TexPixelsRGBA32 + y * atlas->TexWidth + r.x;
+                for (int x = 0; x < r.w; x++)
+                    dst[x] = IM_COL32(255, 255, 255, (unsigned int)src[x]);
+            }
+        if (atlas->TexDirtyX0 >= atlas->TexDirtyX1)
+        {
+            atlas->TexDirtyX0 = r.x; atlas->TexDirtyY0 = r.y;
+            atlas->TexDirtyX1 = r.x + r.w; atlas->TexDirtyY1 = r.y + r.h;
+        }
+        else
+        {
+            atlas->TexDirtyX0 = ImMin(atlas->TexDirtyX0, (int)r.x); atlas->TexDirtyY0 = ImMin(atlas->TexDirtyY0, (int)r.y);
+            atlas->TexDirtyX1 = ImMax(atlas->TexDirtyX1, r.x + r.w); atlas->TexDirtyY1 = ImMax(atlas->TexDirtyY1, r.y + r.h);
+        }
+
+        stbtt_aligned_quad q;
+        float unused_x = 0.0f, unused_y = 0.0f;
+        stbtt_GetPackedQuad(packed_chars.Data, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
+        dst_font->AddGlyph(&cfg, (ImWchar)codepoints[glyph_i], q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, packed_chars[glyph_i].xadvance);
+        dst_font->AddGlyphToLookupTable(dst_font->Glyphs.Size - 1);
+        glyphs_added++;
+    }
+    return glyphs_added;
+}
+
+int ImFontAtlas::BuildPendingGlyphs()
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    int glyphs_added = 0;
+    ImVector<int> requested, src_codepoints;
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        // Collect requests. Requested codepoints are never requested again, whether the font has them or not.
+        ImFont* font = Fonts[font_i];
+        requested.resize(0);
+        for (int word_n = 0; word_n < font->DynamicGlyphsPending.Size; word_n++)
+            if (ImU32 bits = font->DynamicGlyphsPending[word_n])
+            {
+                font->DynamicGlyphsPending[word_n] = 0;
+                font->DynamicGlyphsAvailable[word_n] &= ~bits;
+                for (int bit_n = 0; bit_n < 32; bit_n++)
+                    if (bits & ((ImU32)1 << bit_n))
+                        if (font->FindGlyphNoFallback((ImWchar)((word_n << 5) + bit_n)) == NULL)
+                            requested.push_back((word_n << 5) + bit_n);
+            }
+        if (requested.empty() || DynamicData == NULL)
+            continue;
+
+        // Dispatch to the first source font which has each glyph, like Build() does
+        for (int src_i = 0; src_i < ConfigData.Size && !requested.empty(); src_i++)
+        {
+            ImFontConfig& cfg = ConfigData[src_i];
+            if (cfg.DstFont != font)
+                continue;
+            src_codepoints.resize(0);
+            int remaining_count = 0;
+            for (int n = 0; n < requested.Size; n++)
+            {
+                const int codepoint = requested[n];
+                if (ImFontAtlasBuildSrcRangesContain(cfg, this, codepoint) && stbtt_FindGlyphIndex(&DynamicData->FontInfos[src_i], codepoint) != 0)
+                    src_codepoints.push_back(codepoint);
+                else
+                    requested[remaining_count++] = codepoint;
+            }
+            requested.resize(remaining_count);
+            if (!src_codepoints.empty())
+                glyphs_added += ImFontAtlasBuildDynamicGlyphsForSource(this, src_i, src_codepoints);
+        }
+    }
+    if (glyphs_added > 0)
+        TexGlyphsGeneration++;
+    return glyphs_added;
+}
+
+bool ImFontAtlas::GetTexDataDirtyRect(int* out_x, int* out_y, int* out_width, int* out_height) const
+{
+    if (TexDirtyX0 >= TexDirtyX1 || TexDirtyY0 >= TexDirtyY1)
+        return false;
+    *out_x = TexDirtyX0;
+    *out_y = TexDirtyY0;
+    *out_width = TexDirtyX1 - TexDirtyX0;
+    *out_height = TexDirtyY1 - TexDirtyY0;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// ImFontAtlas build cache (BuildCacheFilename)
+//-----------------------------------------------------------------------------
+// The cache file stores the output of Build(): texture, glyphs, custom rectangles positions and, with ImFontAtlasFlags_DynamicGlyphs, the packer skyline.
+// It is keyed by a hash of everything Build() reads, including the TTF data. Numbers are stored in native byte order: the file is not meant to be shared between machines.
+
+static const char IM_FONTATLAS_CACHE_MAGIC[4] = { 'I', 'M', 'F', 'A' };
+static const ImU32 IM_FONTATLAS_CACHE_VERSION = 1; // Increment when the layout of the file or the output of Build() changes
+
+struct ImFontAtlasCacheHeader
+{
+    char        Magic[4];
+    ImU32       Version;
+    ImU32       Key;
+    ImU32       DataSize;           // Bytes following the header
+};
+
+ImU32 ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas)
+{
+    // Hash each field separately rather than whole structures: they hold pointers and padding
+    ImU32 key = ImHashData(&IM_FONTATLAS_CACHE_VERSION, sizeof(IM_FONTATLAS_CACHE_VERSION), 0);
+    const int sizes[] = { (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(stbrp_coord), IM_DRAWLIST_TEX_LINES_WIDTH_MAX };
+    key = ImHashData(sizes, sizeof(sizes), key);
+    key = ImHashData(&atlas->Flags, sizeof(atlas->Flags), key);
+    key = ImHashData(&atlas->TexDesiredWidth, sizeof(atlas->TexDesiredWidth), key);
+    key = ImHashData(&atlas->TexGlyphPadding, sizeof(atlas->TexGlyphPadding), key);
+    key = ImHashData(&atlas->TexSdfSpread, sizeof(atlas->TexSdfSpread), key);
+    key = ImHashData(&atlas->Fonts.Size, sizeof(atlas->Fonts.Size), key);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        const int dst_index = atlas->Fonts.index_from_ptr(atlas->Fonts.find(cfg.DstFont));
+        key = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, key);
+        key = ImHashData(&cfg.FontNo, sizeof(cfg.FontNo), key);
+        key = ImHashData(&cfg.SizePixels, sizeof(cfg.SizePixels), key);
+        key = ImHashData(&cfg.OversampleH, sizeof(cfg.OversampleH), key);
+        key = ImHashData(&cfg.OversampleV, sizeof(cfg.OversampleV), key);
+        key = ImHashData(&cfg.PixelSnapH, sizeof(cfg.PixelSnapH), key);
+        key = ImHashData(&cfg.GlyphExtraSpacing, sizeof(cfg.GlyphExtraSpacing), key);
+        key = ImHashData(&cfg.GlyphOffset, sizeof(cfg.GlyphOffset), key);
+        key = ImHashData(&cfg.GlyphMinAdvanceX, sizeof(cfg.GlyphMinAdvanceX), key);
+        key = ImHashData(&cfg.GlyphMaxAdvanceX, sizeof(cfg.GlyphMaxAdvanceX), key);
+        key = ImHashData(&cfg.MergeMode, sizeof(cfg.MergeMode), key);
+        key = ImHashData(&cfg.RasterizerFlags, sizeof(cfg.RasterizerFlags), key);
+        key = ImHashData(&cfg.RasterizerMultiply, sizeof(cfg.RasterizerMultiply), key);
+        key = ImHashData(&cfg.EllipsisChar, sizeof(cfg.EllipsisChar), key);
+        key = ImHashData(&dst_index, sizeof(dst_index), key);
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count])
+            ranges_count++;
+        key = ImHashData(ranges, ranges_count * sizeof(ImWchar), key);
+    }
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_i];
+        const int font_index = r.Font ? atlas->Fonts.index_from_ptr(atlas->Fonts.find(r.Font)) : -1;
+        key = ImHashData(&r.Width, sizeof(r.Width), key);
+        key = ImHashData(&r.Height, sizeof(r.Height), key);
+        key = ImHashData(&r.GlyphID, sizeof(r.GlyphID), key);
+        key = ImHashData(&r.GlyphAdvanceX, sizeof(r.GlyphAdvanceX), key);
+        key = ImHashData(&r.GlyphOffset, sizeof(r.GlyphOffset), key);
+        key = ImHashData(&font_index, sizeof(font_index), key);
+    }
+    return key;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<char>& buf, const void* data, size_t size)
+{
+    const int offset = buf.Size;
+    buf.resize(buf.Size + (int)size);
+    if (size > 0)
+        memcpy(buf.Data + offset, data, size);
+}
+
+// Bounds checked reads from the cache file. Once a read fails, all following reads fail.
+struct ImFontAtlasCacheReader
+{
+    const char*     Ptr;
+    const char*     End;
+
+    bool Read(void* dst, size_t size)
+    {
+        if (Ptr == NULL || (size_t)(End - Ptr) < size)
+        {
+            Ptr = NULL;
+            return false;
+        }
+        memcpy(dst, Ptr, size);
+        Ptr += size;
+        return true;
+    }
+    template<typename T>
+    bool ReadVector(ImVector<T>& dst)
+    {
+        int size = 0;
+        if (!Read(&size, sizeof(size)) || size < 0 || (size_t)(End - Ptr) / sizeof(T) < (size_t)size)
+            return (Ptr = NULL), false;
+        dst.resize(size);
+        return size == 0 || Read(dst.Data, (size_t)size * sizeof(T));
+    }
+};
+
+bool ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename, ImU32 key)
+{
+    ImVector<char> buf;
+    ImFontAtlasCacheHeader header;
+    memcpy(header.Magic, IM_FONTATLAS_CACHE_MAGIC, sizeof(header.Magic));
+    header.Version = IM_FONTATLAS_CACHE_VERSION;
+    header.Key = key;
+    header.DataSize = 0;
+    ImFontAtlasCacheWrite(buf, &header, sizeof(header));
+
+    // Atlas
+    ImFontAtlasCacheWrite(buf, &atlas->TexWidth, sizeof(atlas->TexWidth));
+    ImFontAtlasCacheWrite(buf, &atlas->TexHeight, sizeof(atlas->TexHeight));
+    ImFontAtlasCacheWrite(buf, &atlas->TexUvWhitePixel, sizeof(atlas->TexUvWhitePixel));
+    ImFontAtlasCacheWrite(buf, atlas->TexUvLines, sizeof(atlas->TexUvLines));
+    ImFontAtlasCacheWrite(buf, &atlas->CustomRects.Size, sizeof(atlas->CustomRects.Size));
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        ImFontAtlasCacheWrite(buf, &atlas->CustomRects[rect_i].X, sizeof(atlas->CustomRects[rect_i].X));
+        ImFontAtlasCacheWrite(buf, &atlas->CustomRects[rect_i].Y, sizeof(atlas->CustomRects[rect_i].Y));
+    }
+
+    // Fonts
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        const ImFont* font = atlas->Fonts[font_i];
+        ImFontAtlasCacheWrite(buf, &font->Ascent, sizeof(font->Ascent));
+        ImFontAtlasCacheWrite(buf, &font->Descent, sizeof(font->Descent));
+        ImFontAtlasCacheWrite(buf, &font->MetricsTotalSurface, sizeof(font->MetricsTotalSurface));
+        ImFontAtlasCacheWrite(buf, &font->FallbackChar, sizeof(font->FallbackChar));
+        ImFontAtlasCacheWrite(buf, &font->EllipsisChar, sizeof(font->EllipsisChar));
+        ImFontAtlasCacheWrite(buf, &font->Glyphs.Size, sizeof(font->Glyphs.Size));
+        ImFontAtlasCacheWrite(buf, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        ImFontAtlasCacheWrite(buf, &font->DynamicGlyphsAvailable.Size, sizeof(font->DynamicGlyphsAvailable.Size));
+        ImFontAtlasCacheWrite(buf, font->DynamicGlyphsAvailable.Data, (size_t)font->DynamicGlyphsAvailable.size_in_bytes());
+    }
+
+    // Packer skyline, from left to right (excluding the sentinel node)
+    if (atlas->DynamicData)
+    {
+        ImVector<stbrp_coord> skyline;
+        const stbrp_context* pack_context = (const stbrp_context*)atlas->DynamicData->PackContext.pack_info;
+        for (const stbrp_node* node = pack_context->active_head; node->next != NULL; node = node->next)
+        {
+            skyline.push_back(node->x);
+            skyline.push_back(node->y);
+        }
+        ImFontAtlasCacheWrite(buf, &skyline.Size, sizeof(skyline.Size));
+        ImFontAtlasCacheWrite(buf, skyline.Data, (size_t)skyline.size_in_bytes());
+    }
+
+    // Texture
+    ImFontAtlasCacheWrite(buf, atlas->TexPixelsAlpha8, (size_t)atlas->TexWidth * atlas->TexHeight);
+    ((ImFontAtlasCacheHeader*)buf.Data)->DataSize = (ImU32)(buf.Size - sizeof(header));
+
+    // Write to a temporary file first, so a reader never sees a partially written cache
+    ImVector<char> tmp_filename;
+    tmp_filename.resize((int)strlen(filename) + 5);
+    ImFormatString(tmp_filename.Data, (size_t)tmp_filename.Size, "%s.tmp", filename);
+    ImFileHandle f = ImFileOpen(tmp_filename.Data, "wb");
+    if (f == NULL)
+        return false;
+    const bool written = ImFileWrite(buf.Data, 1, (ImU64)buf.Size, f) == (ImU64)buf.Size;
+    ImFileClose(f);
+    remove(filename);
+    if (!written || rename(tmp_filename.Data, filename) != 0)
+    {
+        remove(tmp_filename.Data);
+        return false;
+    }
+    return true;
+}
+
+// Read-only view of a whole file, memory mapped where available
+struct ImFontAtlasCacheFile
+{
+    void*           Data;
+    size_t          Size;
+    bool            Mapped;
+};
+
+static bool ImFontAtlasCacheFileOpen(const char* filename, ImFontAtlasCacheFile* out_file)
+{
+    out_file->Data = NULL;
+    out_file->Size = 0;
+    out_file->Mapped = false;
+#if defined(IMGUI_FONTATLAS_CACHE_MMAP)
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            out_file->Data = data;
+            out_file->Size = (size_t)st.st_size;
+            out_file->Mapped = true;
+        }
+    }
+    close(fd);
+#else
+    out_file->Data = ImFileLoadToMemory(filename, "rb", &out_file->Size);
+#endif
+    return out_file->Data != NULL;
+}
+
+static void ImFontAtlasCacheFileClose(ImFontAtlasCacheFile* file)
+{
+#if defined(IMGUI_FONTATLAS_CACHE_MMAP)
+    if (file->Mapped)
+        munmap(file->Data, file->Size);
+#else
+    IM_FREE(file->Data);
+#endif
+    file->Data = NULL;
+}
+
+// Restore the output of a previous Build() with the same key. On failure the caller rebuilds: Build() resets everything we may have modified.
+bool ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename, ImU32 key)
+{
+    ImFontAtlasCacheFile file;
+    if (!ImFontAtlasCacheFileOpen(filename, &file))
+        return false;
+    ImFontAtlasCacheHeader header;
+    ImFontAtlasCacheReader reader = { (const char*)file.Data, (const char*)file.Data + file.Size };
+    if (!reader.Read(&header, sizeof(header)) || memcmp(header.Magic, IM_FONTATLAS_CACHE_MAGIC, sizeof(header.Magic)) != 0 ||
+        header.Version != IM_FONTATLAS_CACHE_VERSION || header.Key != key || header.DataSize != file.Size - sizeof(header))
+    {
+        ImFontAtlasCacheFileClose(&file);
+        return false;
+    }
+
+    // Atlas
+    atlas->TexID = (ImTextureID)NULL;
+    atlas->ClearTexData();
+    atlas->ClearTexDataDirtyRect();
+    int custom_rects_count = 0;
+    reader.Read(&atlas->TexWidth, sizeof(atlas->TexWidth));
+    reader.Read(&atlas->TexHeight, sizeof(atlas->TexHeight));
+    reader.Read(&atlas->TexUvWhitePixel, sizeof(atlas->TexUvWhitePixel));
+    reader.Read(atlas->TexUvLines, sizeof(atlas->TexUvLines));
+    reader.Read(&custom_rects_count, sizeof(custom_rects_count));
+    if (custom_rects_count != atlas->CustomRects.Size || atlas->TexWidth <= 0 || atlas->TexHeight <= 0)
+        reader.Ptr = NULL;
+    for (int rect_i = 0; rect_i < custom_rects_count && reader.Ptr; rect_i++)
+    {
+        reader.Read(&atlas->CustomRects[rect_i].X, sizeof(atlas->CustomRects[rect_i].X));
+        reader.Read(&atlas->CustomRects[rect_i].Y, sizeof(atlas->CustomRects[rect_i].Y));
+    }
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+
+    // Fonts: setup every destination font from its source configurations as Build() does, then restore their glyphs
+    for (int font_i = 0; font_i < atlas->Fonts.Size && reader.Ptr; font_i++)
+    {
+        ImFont* font = atlas->Fonts[font_i];
+        float ascent = 0.0f, descent = 0.0f;
+        reader.Read(&ascent, sizeof(ascent));
+        reader.Read(&descent, sizeof(descent));
+        for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+            if (atlas->ConfigData[src_i].DstFont == font)
+                ImFontAtlasBuildSetupFont(atlas, font, &atlas->ConfigData[src_i], ascent, descent);
+        reader.Read(&font->MetricsTotalSurface, sizeof(font->MetricsTotalSurface));
+        reader.Read(&font->FallbackChar, sizeof(font->FallbackChar));
+        reader.Read(&font->EllipsisChar, sizeof(font->EllipsisChar));
+        reader.ReadVector(font->Glyphs);
+        reader.ReadVector(font->DynamicGlyphsAvailable);
+        font->DynamicGlyphsPending.resize(font->DynamicGlyphsAvailable.Size, 0);
+        font->DirtyLookupTables = true;
+    }
+
+    // Packer and source fonts for glyphs added later
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        ImVector<stbrp_coord> skyline;
+        if (reader.ReadVector(skyline))
+        {
+            ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData = IM_NEW(ImFontAtlasDynamicData)();
+            dynamic_data->FontInfos.resize(atlas->ConfigData.Size);
+            for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+            {
+                const ImFontConfig& cfg = atlas->ConfigData[src_i];
+                const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
+                if (font_offset < 0 || !stbtt_InitFont(&dynamic_data->FontInfos[src_i], (unsigned char*)cfg.FontData, font_offset))
+                    reader.Ptr = NULL;
+            }
+
+            // Rebuild the skyline list from the free nodes (the first extra node may have been part of it)
+            stbtt_pack_context& spc = dynamic_data->PackContext;
+            stbtt_PackBegin(&spc, NULL, atlas->TexWidth, IM_FONTATLAS_TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
+            stbrp_context* pack_context = (stbrp_context*)spc.pack_info;
+            pack_context->extra[0].next = pack_context->free_head;
+            pack_context->free_head = &pack_context->extra[0];
+            stbrp_node** p_next = &pack_context->active_head;
+            for (int coord_i = 0; coord_i + 1 < skyline.Size && pack_context->free_head != NULL; coord_i += 2)
+            {
+                stbrp_node* node = pack_context->free_head;
+                pack_context->free_head = node->next;
+                node->x = skyline[coord_i];
+                node->y = skyline[coord_i + 1];
+                *p_next = node;
+                p_next = &node->next;
+            }
+            *p_next = &pack_context->extra[1];
+            if (skyline.Size == 0 || (skyline.Size & 1) || pack_context->active_head->x != 0)
+                reader.Ptr = NULL;
+        }
+    }
+
+    // Texture
+    const size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight;
+    if (reader.Ptr && (size_t)(reader.End - reader.Ptr) == tex_size)
+    {
+        atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
+        reader.Read(atlas->TexPixelsAlpha8, tex_size);
+    }
+    else
+    {
+        reader.Ptr = NULL;
+    }
+    ImFontAtlasCacheFileClose(&file);
+    if (reader.Ptr == NULL)
+    {
+        atlas->ClearTexData();
+        return false;
+    }
+
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        atlas->Fonts[font_i]->BuildLookupTable();
+    return true;
+}
+
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
 {
     if (!font_config->MergeMode)
@@ -2421,7 +3479,7 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
 
 static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
 {
-    if (atlas->Flags & ImFontAtlasFlags_NoBakedLines)
+    if (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF))
         return;
 
     // This generates a triangular shape in the texture, with the various line widths stacked on top of each other to allow interpolation between them
@@ -2466,7 +3524,7 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
     // The +2 here is to give space for the end caps, whilst height +1 is to accommodate the fact we have a zero-width row
     if (atlas->PackIdLines < 0)
     {
-        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        if (!(atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF))) // Their alpha gradient would be read as a distance
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
 }
@@ -2806,6 +3864,8 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    DynamicGlyphsAvailable.clear();
+    DynamicGlyphsPending.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
@@ -2815,6 +3875,7 @@ void    ImFont::ClearOutputData()
 
 void ImFont::BuildLookupTable()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -2890,6 +3951,7 @@ void ImFont::SetFallbackChar(ImWchar c)
 
 void ImFont::GrowIndex(int new_size)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
     if (new_size <= IndexLookup.Size)
         return;
@@ -2943,6 +4005,41 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     MetricsTotalSurface += (int)((glyph.U1 - glyph.U0) * ContainerAtlas->TexWidth + pad) * (int)((glyph.V1 - glyph.V0) * ContainerAtlas->TexHeight + pad);
 }
 
+// Register a glyph added after BuildLookupTable() (ImFontAtlasFlags_DynamicGlyphs), without rebuilding the whole table
+void ImFont::AddGlyphToLookupTable(int glyph_idx)
+{
+    IM_ASSERT(glyph_idx < 0xFFFF); // -1 is reserved
+    const int codepoint = (int)Glyphs[glyph_idx].Codepoint;
+    const int old_size = IndexLookup.Size;
+    GrowIndex(codepoint + 1);
+    for (int i = old_size; i < IndexAdvanceX.Size; i++)
+        IndexAdvanceX[i] = FallbackAdvanceX;
+    IndexAdvanceX[codepoint] = Glyphs[glyph_idx].AdvanceX;
+    IndexLookup[codepoint] = (ImWchar)glyph_idx;
+    const int page_n = codepoint / 4096;
+    Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+    DirtyLookupTables = false;
+
+    // Glyphs[] may have been reallocated
+    FallbackGlyph = FindGlyphNoFallback(FallbackChar);
+}
+
+// Called by FindGlyph() on a missing glyph. The glyph is rasterized by the next ImFontAtlas::BuildPendingGlyphs() if the font ranges include it.
+// Several threads may render text with the same font: set the bit atomically. BuildPendingGlyphs() only runs once they are done.
+void ImFont::RequestDynamicGlyph(ImWchar c) const
+{
+    const int word_n = (int)c >> 5;
+    const ImU32 mask = (ImU32)1 << (c & 31);
+    if (word_n >= DynamicGlyphsAvailable.Size || !(DynamicGlyphsAvailable.Data[word_n] & mask))
+        return;
+    ImU32* pending = &DynamicGlyphsPending.Data[word_n];
+#if defined(_MSC_VER)
+    _InterlockedOr((volatile long*)pending, (long)mask);
+#else
+    __atomic_fetch_or(pending, mask, __ATOMIC_RELAXED);
+#endif
+}
+
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
@@ -2960,11 +4057,13 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = (c < (size_t)IndexLookup.Size) ? IndexLookup.Data[c] : (ImWchar)-1;
     if (i == (ImWchar)-1)
+    {
+        if (!DynamicGlyphsAvailable.empty())
+            RequestDynamicGlyph(c);
         return FallbackGlyph;
+    }
     return &Glyphs.Data[i];
 }
 
@@ -3183,6 +4282,35 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && (defined(IMGUI_DRAWVERT_POS_FIXED16) == defined(IMGUI_DRAWVERT_UV_UNORM16)) // Default or 12 bytes layout
+#define IMGUI_RENDER_TEXT_SSE
+
+// Return the end of the run of printable ASCII characters (0x20..0x7F) starting at 'text'.
+static inline const char* ImTextFindPrintableAsciiEnd(const char* text, const char* text_end)
+{
+    // Control characters and UTF-8 sequence bytes (negative as signed char) both compare less than 0x20
+    const __m128i printable_min = _mm_set1_epi8(0x20);
+    while (text_end - text >= 16)
+    {
+        const int mask = _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)text), printable_min));
+        if (mask != 0)
+        {
+#if defined(_MSC_VER)
+            unsigned long bit_n;
+            _BitScanForward(&bit_n, (unsigned long)mask);
+            return text + bit_n;
+#else
+            return text + __builtin_ctz((unsigned int)mask);
+#endif
+        }
+        text += 16;
+    }
+    while (text < text_end && (signed char)*text >= 0x20)
+        text++;
+    return text;
+}
+#endif
+
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
     if (!text_end)
@@ -3238,6 +4366,26 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
 
+#ifdef IMGUI_RENDER_TEXT_SSE
+#ifndef IMGUI_DRAWVERT_POS_FIXED16
+    // Each vertex is written as one 16-bytes store of pos+uv followed by the color
+    IM_STATIC_ASSERT(sizeof(ImDrawVert) == 20 && IM_OFFSETOF(ImDrawVert, pos) == 0 && IM_OFFSETOF(ImDrawVert, uv) == 8 && IM_OFFSETOF(ImDrawVert, col) == 16);
+#else
+    // Both corners and both texture coordinates are encoded at once, with the same arithmetic as ImDrawVertPosFixed16::Encode() and ImDrawVertUVUnorm16::Encode()
+    IM_STATIC_ASSERT(sizeof(ImDrawVert) == 12 && IM_OFFSETOF(ImDrawVert, pos) == 0 && IM_OFFSETOF(ImDrawVert, uv) == 4 && IM_OFFSETOF(ImDrawVert, col) == 8);
+    const __m128 pos_scale4 = _mm_set1_ps((float)(1 << IMGUI_DRAWVERT_POS_FRAC_BITS));
+    const __m128 pos_bias4 = _mm_set1_ps(32768.5f);
+    const __m128 unorm16_max4 = _mm_set1_ps(65535.0f);
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    const __m128i bias_32768 = _mm_set1_epi32(32768);
+    const __m128i uv_sign_flip = _mm_set1_epi16((short)0x8000);
+#endif
+    const __m128 scale4 = _mm_set1_ps(scale);
+    const __m128i idx_offsets_16 = _mm_setr_epi16(0, 1, 2, 0, 2, 3, 0, 0);
+    const __m128i idx_offsets_32_lo = _mm_setr_epi32(0, 1, 2, 0);
+    const __m128i idx_offsets_32_hi = _mm_setr_epi32(2, 3, 0, 0);
+#endif
+
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -3255,6 +4403,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 x = pos.x;
                 y += line_height;
                 word_wrap_eol = NULL;
+                if (y > clip_rect.w)
+                    break; // break out of main loop
 
                 // Wrapping skips upcoming blanks
                 while (s < text_end)
@@ -3266,6 +4416,92 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             }
         }
 
+        // Skip the rest of the line when it is above the clipping rectangle (lines above were already skipped unless word-wrapping)
+        // or when past its right edge, with a margin of one line height for glyphs extending to the left of their position.
+        if (y + line_height < clip_rect.y || x > clip_rect.z + line_height)
+        {
+            const char* line_end = word_wrap_enabled ? word_wrap_eol : text_end;
+            const char* line_nl = (const char*)memchr(s, '\n', line_end - s);
+            if (line_nl == NULL)
+            {
+                s = line_end; // Handled as a wrap above, or the end of the text
+                continue;
+            }
+            s = line_nl + 1;
+            x = pos.x;
+            y += line_height;
+            if (y > clip_rect.w)
+                break; // break out of main loop
+            continue;
+        }
+
+#ifdef IMGUI_RENDER_TEXT_SSE
+        // Fast path for runs of printable ASCII characters, which make up most UI text: the run is found 16 bytes at a time,
+        // then glyphs need no UTF-8 decoding nor control character tests, and both quad corners are positioned at once.
+        // Same arithmetic as the generic path below, so the output is identical.
+        if (!cpu_fine_clip && (signed char)*s >= 0x20)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, (word_wrap_enabled && word_wrap_eol < text_end) ? word_wrap_eol : text_end);
+            for (; s < run_end && x <= clip_rect.z + line_height; s++)
+            {
+                const ImFontGlyph* glyph = FindGlyph((ImWchar)*s);
+                if (glyph == NULL)
+                    continue;
+                if (glyph->Visible)
+                {
+                    const __m128 p = _mm_add_ps(_mm_setr_ps(x, y, x, y), _mm_mul_ps(_mm_loadu_ps(&glyph->X0), scale4)); // x1, y1, x2, y2
+                    if (_mm_cvtss_f32(p) <= clip_rect.z && _mm_cvtss_f32(_mm_movehl_ps(p, p)) >= clip_rect.x)
+                    {
+                        const __m128 uv = _mm_loadu_ps(&glyph->U0);                                 // u1, v1, u2, v2
+#ifndef IMGUI_DRAWVERT_POS_FIXED16
+                        float* vtx_dst = (float*)(void*)vtx_write;
+                        _mm_storeu_ps(vtx_dst + 0, _mm_movelh_ps(p, uv));                           // x1, y1, u1, v1
+                        _mm_storeu_ps(vtx_dst + 5, _mm_shuffle_ps(p, uv, _MM_SHUFFLE(1, 2, 1, 2)));  // x2, y1, u2, v1
+                        _mm_storeu_ps(vtx_dst + 10, _mm_movehl_ps(uv, p));                          // x2, y2, u2, v2
+                        _mm_storeu_ps(vtx_dst + 15, _mm_shuffle_ps(p, uv, _MM_SHUFFLE(3, 0, 3, 0))); // x1, y2, u1, v2
+                        vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = col;
+#else
+                        // Biased to 0..65535 so truncation rounds to nearest, then re-centered so both halves pack with signed saturation
+                        const __m128 p_fixed = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(p, pos_scale4), pos_bias4), _mm_setzero_ps()), unorm16_max4);
+                        const __m128 uv_unorm = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(uv, _mm_setzero_ps()), _mm_set1_ps(1.0f)), unorm16_max4), half4);
+                        const __m128i p_i = _mm_sub_epi32(_mm_cvttps_epi32(p_fixed), bias_32768);
+                        const __m128i uv_i = _mm_sub_epi32(_mm_cvttps_epi32(uv_unorm), bias_32768);
+                        const __m128i packed = _mm_xor_si128(_mm_packs_epi32(p_i, uv_i), _mm_unpackhi_epi64(_mm_setzero_si128(), uv_sign_flip));
+                        const __m128i swapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(packed, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2)); // (x2, y1), (x1, y2), (u2, v1), (u1, v2)
+                        const __m128i lo = _mm_unpacklo_epi32(packed, swapped);
+                        const __m128i hi = _mm_unpackhi_epi32(packed, swapped);
+                        const __m128i v01 = _mm_unpacklo_epi32(lo, hi);                           // x1, y1, u1, v1, x2, y1, u2, v1
+                        const __m128i v23 = _mm_unpackhi_epi32(lo, hi);                           // x2, y2, u2, v2, x1, y2, u1, v2
+                        _mm_storel_epi64((__m128i*)(void*)&vtx_write[0], v01);
+                        _mm_storel_epi64((__m128i*)(void*)&vtx_write[1], _mm_unpackhi_epi64(v01, v01));
+                        _mm_storel_epi64((__m128i*)(void*)&vtx_write[2], v23);
+                        _mm_storel_epi64((__m128i*)(void*)&vtx_write[3], _mm_unpackhi_epi64(v23, v23));
+                        vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = col;
+#endif
+                        if (sizeof(ImDrawIdx) == 2)
+                        {
+                            const __m128i idx = _mm_add_epi16(_mm_set1_epi16((short)vtx_current_idx), idx_offsets_16);
+                            const int idx_45 = _mm_cvtsi128_si32(_mm_srli_si128(idx, 8));
+                            _mm_storel_epi64((__m128i*)(void*)idx_write, idx);
+                            memcpy(idx_write + 4, &idx_45, sizeof(idx_45));
+                        }
+                        else
+                        {
+                            const __m128i base = _mm_set1_epi32((int)vtx_current_idx);
+                            _mm_storeu_si128((__m128i*)(void*)idx_write, _mm_add_epi32(base, idx_offsets_32_lo));
+                            _mm_storel_epi64((__m128i*)(void*)(idx_write + 4), _mm_add_epi32(base, idx_offsets_32_hi));
+                        }
+                        vtx_write += 4;
+                        vtx_current_idx += 4;
+                        idx_write += 6;
+                    }
+                }
+                x += glyph->AdvanceX * scale;
+            }
+            continue;
+        }
+#endif
+
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
@@ -3347,10 +4583,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(u1, v2);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
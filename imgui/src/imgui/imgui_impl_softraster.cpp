@@ -0,0 +1,856 @@
+// dear imgui: Renderer for CPU software rasterization into an in-memory RGBA framebuffer
+// - No GPU, OpenGL context or window required: suitable for headless screenshots and CI performance runs.
+// This needs to be used along with a Platform Binding (e.g. GLFW), or with io.DisplaySize/io.DeltaTime filled by hand when headless.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile binning and rasterization. SSE2 span filling for flat colored triangles.
+//  [X] Renderer: PNG export of the framebuffer.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+// CHANGELOG
+//  2020-10-23: Keep the rasterizer threads alive from Init() to Shutdown() instead of starting them for every batch.
+//  2020-10-22: Support compact ImDrawVert layouts (IMGUI_DRAWVERT_POS_FIXED16, IMGUI_DRAWVERT_UV_UNORM16).
+//  2020-10-21: Threshold the font texture when the atlas is built with ImFontAtlasFlags_SDF, with bilinear filtering of distances.
+//  2020-10-19: Initial version.
+
+// Overview of a frame:
+//  1. Triangles of all ImDrawCmd between two user callbacks form a batch.
+//  2. Binning: each thread sets up a contiguous range of the batch's triangles (projection, clipping, flat color detection)
+//     and appends their index to the per-tile lists it owns. A thread only ever sees its own lists, so no locking is needed.
+//  3. Rasterization: threads grab whole tiles and walk the per-thread lists of that tile in thread order. As thread N
+//     binned triangles that come before those of thread N+1, this preserves submission order inside every tile.
+// The threads are started by Init() and sleep on a condition variable between steps 2 and 3 and between frames.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <string.h>     // memset, memcpy
+#include <math.h>       // ceilf, floorf, sqrtf
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_IMPL_SOFTRASTER_SSE2
+#include <emmintrin.h>
+#endif
+
+// Triangle after setup, in framebuffer space
+struct ImGui_ImplSoftRaster_Tri
+{
+    ImVec2  Pos[3];                 // Sorted by y then x, so that shared edges are evaluated identically by both triangles
+    ImVec2  Uv[3];
+    ImU32   Col[3];
+    int     MinX, MinY, MaxX, MaxY; // Bounding box intersected with clipping rectangle (max is exclusive). Empty if culled.
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    ImU32   FlatCol;                // Valid when Flat: texel * vertex color, constant over the triangle
+    bool    Flat;
+    bool    Sdf;                    // Texture alpha is a distance field (font atlas built with ImFontAtlasFlags_SDF)
+};
+
+// Draw command of the current batch
+struct ImGui_ImplSoftRaster_Batch
+{
+    const ImDrawList*   CmdList;
+    const ImDrawCmd*    Cmd;
+    int                 FirstTri;   // Index of the first triangle of this command in the batch
+};
+
+// Per-thread binning output: triangle indices grouped by tile (counting sort)
+struct ImGui_ImplSoftRaster_Worker
+{
+    ImVector<int>   TileOffsets;    // TilesCount + 1 entries
+    ImVector<int>   TileCursor;
+    ImVector<int>   TileTris;
+    int             TriBegin, TriEnd;
+};
+
+// Data
+static int                                  g_ThreadsCount = 1;
+static ImGui_ImplSoftRaster_Worker          g_Workers[IMGUI_IMPL_SOFTRASTER_MAX_THREADS];
+static ImVector<ImU32>                      g_FbPixels;
+static int                                  g_FbWidth = 0, g_FbHeight = 0;
+static int                                  g_TilesX = 0, g_TilesY = 0;
+static ImVector<ImGui_ImplSoftRaster_Batch> g_Batches;
+static ImVector<ImGui_ImplSoftRaster_Tri>   g_Tris;
+static std::atomic<int>                     g_NextTile(0);
+static ImDrawData*                          g_DrawData = NULL;
+static ImVector<ImU32>                      g_FontPixels;
+static ImGui_ImplSoftRaster_Texture         g_FontTexture = { NULL, 0, 0 };
+static float                                g_FontSdfSlope = 0.0f;      // Change of normalized font texture alpha per texel, 0.0f when the atlas is not a distance field
+
+// Thread pool: threads 1..g_ThreadsCount-1 wait for jobs, the calling thread runs as thread 0
+static std::thread                          g_Threads[IMGUI_IMPL_SOFTRASTER_MAX_THREADS];
+static std::mutex                           g_JobMutex;
+static std::condition_variable              g_JobStartCv;
+static std::condition_variable              g_JobDoneCv;
+static void                                 (*g_JobFunc)(int worker_idx) = NULL;
+static unsigned int                         g_JobGeneration = 0;        // Bumped for every job
+static int                                  g_JobPendingCount = 0;      // Pool threads still running the current job
+static bool                                 g_ThreadsQuit = false;
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+template<typename T> static inline T ImGui_ImplSoftRaster_Min(T a, T b) { return a < b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Max(T a, T b) { return a >= b ? a : b; }
+
+// Exact rounded division by 255 for x in [0, 255*255]
+static inline unsigned int ImGui_ImplSoftRaster_Div255(unsigned int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Modulate(ImU32 a, ImU32 b)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImU32 dst, ImU32 src)
+{
+    unsigned int a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return dst;
+    if (a == 255)
+        return src;
+    unsigned int inv_a = 255 - a;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((src >> shift) & 0xFF) * a + ((dst >> shift) & 0xFF) * inv_a) << shift;
+    return out;
+}
+
+// Blend a constant color over a horizontal span of pixels
+static void ImGui_ImplSoftRaster_FillSpan(ImU32* dst, int count, ImU32 src)
+{
+    unsigned int a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return;
+    if (a == 255)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = src;
+        return;
+    }
+#ifdef IMGUI_IMPL_SOFTRASTER_SSE2
+    // 4 pixels per iteration: widen to 16-bit lanes, dst * (255 - a) + src * a, then the same rounded /255 as the scalar path.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src_term = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)src), zero), _mm_set1_epi16((short)a));
+    const __m128i inv_a = _mm_set1_epi16((short)(255 - a));
+    const __m128i bias = _mm_set1_epi16(128);
+    for (; count >= 4; count -= 4, dst += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)dst);
+        __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_a), src_term), bias);
+        __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_a), src_term), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (int n = 0; n < count; n++)
+        dst[n] = ImGui_ImplSoftRaster_Blend(dst[n], src);
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Sample(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    int x = (int)(u * tex->Width);
+    int y = (int)(v * tex->Height);
+    x = (x < 0) ? 0 : (x >= tex->Width) ? tex->Width - 1 : x;
+    y = (y < 0) ? 0 : (y >= tex->Height) ? tex->Height - 1 : y;
+    return tex->Pixels[y * tex->Width + x];
+}
+
+// Sample a distance field texture: distances are filtered bilinearly, then thresholded at 0.5 with a ramp of +/- 'half_width' for anti-aliasing
+static inline ImU32 ImGui_ImplSoftRaster_SampleSdf(const ImGui_ImplSoftRaster_Texture* tex, float u, float v, float half_width)
+{
+    const float fx = u * tex->Width - 0.5f, fy = v * tex->Height - 0.5f;
+    const float fx0 = floorf(fx), fy0 = floorf(fy);
+    const float tx = fx - fx0, ty = fy - fy0;
+    int x0 = (int)fx0, y0 = (int)fy0;
+    int x1 = x0 + 1, y1 = y0 + 1;
+    x0 = (x0 < 0) ? 0 : (x0 >= tex->Width) ? tex->Width - 1 : x0;
+    x1 = (x1 < 0) ? 0 : (x1 >= tex->Width) ? tex->Width - 1 : x1;
+    y0 = (y0 < 0) ? 0 : (y0 >= tex->Height) ? tex->Height - 1 : y0;
+    y1 = (y1 < 0) ? 0 : (y1 >= tex->Height) ? tex->Height - 1 : y1;
+    const ImU32* row0 = &tex->Pixels[y0 * tex->Width];
+    const ImU32* row1 = &tex->Pixels[y1 * tex->Width];
+    const float a00 = (float)(row0[x0] >> IM_COL32_A_SHIFT), a10 = (float)(row0[x1] >> IM_COL32_A_SHIFT);
+    const float a01 = (float)(row1[x0] >> IM_COL32_A_SHIFT), a11 = (float)(row1[x1] >> IM_COL32_A_SHIFT);
+    const float top = a00 + (a10 - a00) * tx, bottom = a01 + (a11 - a01) * tx;
+    const float dist = (top + (bottom - top) * ty) * (1.0f / 255.0f);
+
+    // Same as smoothstep(0.5 - half_width, 0.5 + half_width, dist) in the OpenGL3 back-end
+    float t = (dist - 0.5f + half_width) / (2.0f * half_width);
+    t = (t < 0.0f) ? 0.0f : (t > 1.0f) ? 1.0f : t;
+    const ImU32 alpha = (ImU32)(t * t * (3.0f - 2.0f * t) * 255.0f + 0.5f);
+    return (row0[x0] & ~IM_COL32_A_MASK) | (alpha << IM_COL32_A_SHIFT);
+}
+
+//-----------------------------------------------------------------------------
+// Triangle setup and rasterization
+//-----------------------------------------------------------------------------
+
+static inline bool ImGui_ImplSoftRaster_VertexLess(const ImDrawVert& a, const ImDrawVert& b)
+{
+    const ImVec2 a_pos = a.pos, b_pos = b.pos;
+    return (a_pos.y < b_pos.y) || (a_pos.y == b_pos.y && a_pos.x < b_pos.x);
+}
+
+static void ImGui_ImplSoftRaster_SetupTri(ImGui_ImplSoftRaster_Tri* tri, const ImDrawVert* vtx, const ImDrawIdx* idx, const ImDrawCmd* pcmd)
+{
+    const ImVec2 clip_off = g_DrawData->DisplayPos;
+    const ImVec2 clip_scale = g_DrawData->FramebufferScale;
+
+    // Sort vertices by y, so that the same edge is always evaluated from the same end point
+    const ImDrawVert* v[3] = { &vtx[idx[0]], &vtx[idx[1]], &vtx[idx[2]] };
+    if (ImGui_ImplSoftRaster_VertexLess(*v[1], *v[0])) { const ImDrawVert* tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+    if (ImGui_ImplSoftRaster_VertexLess(*v[2], *v[1])) { const ImDrawVert* tmp = v[1]; v[1] = v[2]; v[2] = tmp; }
+    if (ImGui_ImplSoftRaster_VertexLess(*v[1], *v[0])) { const ImDrawVert* tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+    for (int n = 0; n < 3; n++)
+    {
+        const ImVec2 pos = v[n]->pos;
+        tri->Pos[n] = ImVec2((pos.x - clip_off.x) * clip_scale.x, (pos.y - clip_off.y) * clip_scale.y);
+        tri->Uv[n] = v[n]->uv;
+        tri->Col[n] = v[n]->col;
+    }
+
+    // Same integer truncation of the clipping rectangle as glScissor() in the OpenGL3 back-end
+    int clip_min_x = (int)((pcmd->ClipRect.x - clip_off.x) * clip_scale.x);
+    int clip_min_y = (int)((pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+    int clip_max_x = (int)((pcmd->ClipRect.z - clip_off.x) * clip_scale.x);
+    int clip_max_y = (int)((pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+
+    // Pixel x is covered when its center x + 0.5 lies in [min, max)
+    float min_x = ImGui_ImplSoftRaster_Min(tri->Pos[0].x, ImGui_ImplSoftRaster_Min(tri->Pos[1].x, tri->Pos[2].x));
+    float max_x = ImGui_ImplSoftRaster_Max(tri->Pos[0].x, ImGui_ImplSoftRaster_Max(tri->Pos[1].x, tri->Pos[2].x));
+    tri->MinX = ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max((int)ceilf(min_x - 0.5f), clip_min_x), 0);
+    tri->MaxX = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min((int)ceilf(max_x - 0.5f), clip_max_x), g_FbWidth);
+    tri->MinY = ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max((int)ceilf(tri->Pos[0].y - 0.5f), clip_min_y), 0);
+    tri->MaxY = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min((int)ceilf(tri->Pos[2].y - 0.5f), clip_max_y), g_FbHeight);
+
+    // Degenerate triangles cover nothing
+    float area = (tri->Pos[1].x - tri->Pos[0].x) * (tri->Pos[2].y - tri->Pos[0].y) - (tri->Pos[2].x - tri->Pos[0].x) * (tri->Pos[1].y - tri->Pos[0].y);
+    if (area == 0.0f)
+        tri->MaxX = tri->MinX;
+
+    tri->Tex = (const ImGui_ImplSoftRaster_Texture*)pcmd->TextureId;
+    tri->Flat = tri->Col[0] == tri->Col[1] && tri->Col[0] == tri->Col[2] &&
+                tri->Uv[0].x == tri->Uv[1].x && tri->Uv[0].x == tri->Uv[2].x &&
+                tri->Uv[0].y == tri->Uv[1].y && tri->Uv[0].y == tri->Uv[2].y;
+    tri->Sdf = (g_FontSdfSlope > 0.0f && tri->Tex == &g_FontTexture);
+    tri->FlatCol = tri->Col[0];
+    if (tri->Flat && tri->Tex != NULL)
+    {
+        // Constant UV (e.g. the white pixel): the distance field is a plain step at 0.5
+        ImU32 texel = ImGui_ImplSoftRaster_Sample(tri->Tex, tri->Uv[0].x, tri->Uv[0].y);
+        if (tri->Sdf)
+            texel = (texel & ~IM_COL32_A_MASK) | (((texel >> IM_COL32_A_SHIFT) >= 128) ? IM_COL32_A_MASK : 0);
+        tri->FlatCol = ImGui_ImplSoftRaster_Modulate(tri->Col[0], texel);
+    }
+}
+
+static inline float ImGui_ImplSoftRaster_EdgeX(const ImVec2& a, const ImVec2& b, float y)
+{
+    return a.x + (y - a.y) * (b.x - a.x) / (b.y - a.y);
+}
+
+// Rasterize the part of a triangle overlapping a tile
+static void ImGui_ImplSoftRaster_RasterTri(const ImGui_ImplSoftRaster_Tri* tri, int tile_min_x, int tile_min_y, int tile_max_x, int tile_max_y)
+{
+    const int min_x = ImGui_ImplSoftRaster_Max(tri->MinX, tile_min_x), max_x = ImGui_ImplSoftRaster_Min(tri->MaxX, tile_max_x);
+    const int min_y = ImGui_ImplSoftRaster_Max(tri->MinY, tile_min_y), max_y = ImGui_ImplSoftRaster_Min(tri->MaxY, tile_max_y);
+    if (min_x >= max_x || min_y >= max_y)
+        return;
+    const ImVec2& p0 = tri->Pos[0];
+    const ImVec2& p1 = tri->Pos[1];
+    const ImVec2& p2 = tri->Pos[2];
+
+    // Attribute gradients for the interpolated path: A(x,y) = A0 + dA/dx * (x - x0) + dA/dy * (y - y0)
+    float grad[6][3];   // u, v, r, g, b, a -> { value at p0, d/dx, d/dy }
+    const bool flat_col = (tri->Col[0] == tri->Col[1] && tri->Col[0] == tri->Col[2]);
+    if (!tri->Flat)
+    {
+        const float e1x = p1.x - p0.x, e1y = p1.y - p0.y;
+        const float e2x = p2.x - p0.x, e2y = p2.y - p0.y;
+        const float inv_area = 1.0f / (e1x * e2y - e2x * e1y);
+        float attr[6][3];
+        for (int n = 0; n < 3; n++)
+        {
+            attr[0][n] = tri->Uv[n].x;
+            attr[1][n] = tri->Uv[n].y;
+            for (int c = 0; c < 4; c++)
+                attr[2 + c][n] = (float)((tri->Col[n] >> (c * 8)) & 0xFF);
+        }
+        for (int a = 0; a < 6; a++)
+        {
+            const float d1 = attr[a][1] - attr[a][0];
+            const float d2 = attr[a][2] - attr[a][0];
+            grad[a][0] = attr[a][0];
+            grad[a][1] = (d1 * e2y - d2 * e1y) * inv_area;
+            grad[a][2] = (d2 * e1x - d1 * e2x) * inv_area;
+        }
+    }
+
+    // Distance field ramp half width, approximating 0.5 * fwidth(alpha) from the number of texels covered by a pixel step
+    float sdf_half_width = 0.0f;
+    if (!tri->Flat && tri->Sdf)
+    {
+        const float w = (float)tri->Tex->Width, h = (float)tri->Tex->Height;
+        const float texels_x = sqrtf(grad[0][1] * grad[0][1] * w * w + grad[1][1] * grad[1][1] * h * h);
+        const float texels_y = sqrtf(grad[0][2] * grad[0][2] * w * w + grad[1][2] * grad[1][2] * h * h);
+        sdf_half_width = ImGui_ImplSoftRaster_Max(0.5f * g_FontSdfSlope * ImGui_ImplSoftRaster_Max(texels_x, texels_y), 0.001f);
+    }
+
+    for (int y = min_y; y < max_y; y++)
+    {
+        // Span of the row, pixel centers x + 0.5 in [xl, xr)
+        const float yc = (float)y + 0.5f;
+        const float x_long = ImGui_ImplSoftRaster_EdgeX(p0, p2, yc);
+        const float x_short = (yc < p1.y) ? ImGui_ImplSoftRaster_EdgeX(p0, p1, yc) : ImGui_ImplSoftRaster_EdgeX(p1, p2, yc);
+        const float xl = ImGui_ImplSoftRaster_Min(x_long, x_short), xr = ImGui_ImplSoftRaster_Max(x_long, x_short);
+        const int x0 = ImGui_ImplSoftRaster_Max((int)ceilf(xl - 0.5f), min_x);
+        const int x1 = ImGui_ImplSoftRaster_Min((int)ceilf(xr - 0.5f), max_x);
+        if (x0 >= x1)
+            continue;
+        ImU32* dst = &g_FbPixels.Data[y * g_FbWidth];
+        if (tri->Flat)
+        {
+            ImGui_ImplSoftRaster_FillSpan(dst + x0, x1 - x0, tri->FlatCol);
+            continue;
+        }
+
+        const float dx = (float)x0 + 0.5f - p0.x, dy = yc - p0.y;
+        float attr[6];
+        for (int a = 0; a < 6; a++)
+            attr[a] = grad[a][0] + grad[a][1] * dx + grad[a][2] * dy;
+        for (int x = x0; x < x1; x++)
+        {
+            ImU32 col;
+            if (flat_col)
+                col = tri->Col[0];
+            else
+                col = IM_COL32((int)(attr[2] + 0.5f), (int)(attr[3] + 0.5f), (int)(attr[4] + 0.5f), (int)(attr[5] + 0.5f));
+            if (tri->Sdf)
+                col = ImGui_ImplSoftRaster_Modulate(col, ImGui_ImplSoftRaster_SampleSdf(tri->Tex, attr[0], attr[1], sdf_half_width));
+            else if (tri->Tex != NULL)
+                col = ImGui_ImplSoftRaster_Modulate(col, ImGui_ImplSoftRaster_Sample(tri->Tex, attr[0], attr[1]));
+            dst[x] = ImGui_ImplSoftRaster_Blend(dst[x], col);
+            for (int a = 0; a < 6; a++)
+                attr[a] += grad[a][1];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Threading
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_ThreadMain(int worker_idx)
+{
+    unsigned int generation = 0;
+    for (;;)
+    {
+        void (*func)(int worker_idx);
+        {
+            std::unique_lock<std::mutex> lock(g_JobMutex);
+            while (!g_ThreadsQuit && g_JobGeneration == generation)
+                g_JobStartCv.wait(lock);
+            if (g_ThreadsQuit)
+                return;
+            generation = g_JobGeneration;
+            func = g_JobFunc;
+        }
+        func(worker_idx);
+        {
+            std::lock_guard<std::mutex> lock(g_JobMutex);
+            if (--g_JobPendingCount == 0)
+                g_JobDoneCv.notify_one();
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_StartThreads()
+{
+    g_ThreadsQuit = false;
+    for (int n = 1; n < g_ThreadsCount; n++)
+        g_Threads[n] = std::thread(ImGui_ImplSoftRaster_ThreadMain, n);
+}
+
+static void ImGui_ImplSoftRaster_StopThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_JobMutex);
+        g_ThreadsQuit = true;
+    }
+    g_JobStartCv.notify_all();
+    for (int n = 1; n < IMGUI_IMPL_SOFTRASTER_MAX_THREADS; n++)
+        if (g_Threads[n].joinable())
+            g_Threads[n].join();
+}
+
+// Run func(0) on the calling thread and func(1..g_ThreadsCount-1) on the pool threads, and wait for all of them
+static void ImGui_ImplSoftRaster_RunWorkers(void (*func)(int worker_idx))
+{
+    if (g_ThreadsCount <= 1)
+    {
+        func(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_JobMutex);
+        g_JobFunc = func;
+        g_JobPendingCount = g_ThreadsCount - 1;
+        g_JobGeneration++;
+    }
+    g_JobStartCv.notify_all();
+    func(0);
+    std::unique_lock<std::mutex> lock(g_JobMutex);
+    while (g_JobPendingCount > 0)
+        g_JobDoneCv.wait(lock);
+}
+
+static void ImGui_ImplSoftRaster_BinWorker(int worker_idx)
+{
+    ImGui_ImplSoftRaster_Worker& w = g_Workers[worker_idx];
+    const int tiles_count = g_TilesX * g_TilesY;
+    w.TileOffsets.resize(tiles_count + 1);
+    memset(w.TileOffsets.Data, 0, (size_t)w.TileOffsets.size_in_bytes());
+    if (w.TriBegin >= w.TriEnd)
+        return;
+
+    // Find the command holding our first triangle
+    int batch_n = 0;
+    for (int lo = 0, hi = g_Batches.Size - 1; lo <= hi; )
+    {
+        int mid = (lo + hi) / 2;
+        if (g_Batches[mid].FirstTri <= w.TriBegin) { batch_n = mid; lo = mid + 1; }
+        else { hi = mid - 1; }
+    }
+
+    // Setup triangles and count them per tile
+    for (int tri_n = w.TriBegin; tri_n < w.TriEnd; tri_n++)
+    {
+        while (batch_n + 1 < g_Batches.Size && g_Batches[batch_n + 1].FirstTri <= tri_n)
+            batch_n++;
+        const ImGui_ImplSoftRaster_Batch& batch = g_Batches[batch_n];
+        const ImDrawCmd* pcmd = batch.Cmd;
+        const ImDrawIdx* idx = batch.CmdList->IdxBuffer.Data + pcmd->IdxOffset + (tri_n - batch.FirstTri) * 3;
+        ImGui_ImplSoftRaster_Tri* tri = &g_Tris[tri_n];
+        ImGui_ImplSoftRaster_SetupTri(tri, batch.CmdList->VtxBuffer.Data + pcmd->VtxOffset, idx, pcmd);
+        if (tri->MinX >= tri->MaxX || tri->MinY >= tri->MaxY)
+            continue;
+        for (int ty = tri->MinY / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (tri->MaxY - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = tri->MinX / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (tri->MaxX - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                w.TileOffsets[ty * g_TilesX + tx + 1]++;
+    }
+
+    // Prefix sum, then scatter triangle indices into their tiles
+    for (int n = 0; n < tiles_count; n++)
+        w.TileOffsets[n + 1] += w.TileOffsets[n];
+    w.TileTris.resize(w.TileOffsets[tiles_count]);
+    w.TileCursor.resize(tiles_count);
+    memcpy(w.TileCursor.Data, w.TileOffsets.Data, (size_t)w.TileCursor.size_in_bytes());
+    for (int tri_n = w.TriBegin; tri_n < w.TriEnd; tri_n++)
+    {
+        const ImGui_ImplSoftRaster_Tri* tri = &g_Tris[tri_n];
+        if (tri->MinX >= tri->MaxX || tri->MinY >= tri->MaxY)
+            continue;
+        for (int ty = tri->MinY / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (tri->MaxY - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = tri->MinX / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (tri->MaxX - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                w.TileTris[w.TileCursor[ty * g_TilesX + tx]++] = tri_n;
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterWorker(int)
+{
+    const int tiles_count = g_TilesX * g_TilesY;
+    for (int tile_n = g_NextTile++; tile_n < tiles_count; tile_n = g_NextTile++)
+    {
+        const int tile_min_x = (tile_n % g_TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+        const int tile_min_y = (tile_n / g_TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+        const int tile_max_x = ImGui_ImplSoftRaster_Min(tile_min_x + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, g_FbWidth);
+        const int tile_max_y = ImGui_ImplSoftRaster_Min(tile_min_y + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, g_FbHeight);
+        for (int worker_n = 0; worker_n < g_ThreadsCount; worker_n++)
+        {
+            const ImGui_ImplSoftRaster_Worker& w = g_Workers[worker_n];
+            if (w.TriBegin >= w.TriEnd)
+                continue;
+            for (int n = w.TileOffsets[tile_n]; n < w.TileOffsets[tile_n + 1]; n++)
+                ImGui_ImplSoftRaster_RasterTri(&g_Tris[w.TileTris[n]], tile_min_x, tile_min_y, tile_max_x, tile_max_y);
+        }
+    }
+}
+
+// Bin and rasterize the triangles gathered in g_Batches
+static void ImGui_ImplSoftRaster_FlushBatches(int tris_count)
+{
+    if (tris_count == 0)
+    {
+        g_Batches.resize(0);
+        return;
+    }
+    g_Tris.resize(tris_count);
+    for (int n = 0; n < g_ThreadsCount; n++)
+    {
+        g_Workers[n].TriBegin = (int)((long long)tris_count * n / g_ThreadsCount);
+        g_Workers[n].TriEnd = (int)((long long)tris_count * (n + 1) / g_ThreadsCount);
+    }
+    ImGui_ImplSoftRaster_RunWorkers(ImGui_ImplSoftRaster_BinWorker);
+    g_NextTile = 0;
+    ImGui_ImplSoftRaster_RunWorkers(ImGui_ImplSoftRaster_RasterWorker);
+    g_Batches.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    ImGui_ImplSoftRaster_StopThreads();
+    g_ThreadsCount = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Max(threads_count, 1), IMGUI_IMPL_SOFTRASTER_MAX_THREADS);
+    ImGui_ImplSoftRaster_StartThreads();
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_StopThreads();
+    g_ThreadsCount = 1;
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    for (int n = 0; n < IMGUI_IMPL_SOFTRASTER_MAX_THREADS; n++)
+    {
+        g_Workers[n].TileOffsets.clear();
+        g_Workers[n].TileCursor.clear();
+        g_Workers[n].TileTris.clear();
+    }
+    g_FbPixels.clear();
+    g_FbWidth = g_FbHeight = 0;
+    g_Batches.clear();
+    g_Tris.clear();
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    if (!g_FontTexture.Pixels)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+void    ImGui_ImplSoftRaster_Clear(int width, int height, const ImVec4& color)
+{
+    if (width != g_FbWidth || height != g_FbHeight)
+    {
+        g_FbPixels.resize(ImGui_ImplSoftRaster_Max(width * height, 0));
+        g_FbWidth = width;
+        g_FbHeight = height;
+    }
+    const ImU32 col = ImGui::ColorConvertFloat4ToU32(color);
+    for (int n = 0; n < g_FbPixels.Size; n++)
+        g_FbPixels.Data[n] = col;
+}
+
+const ImU32* ImGui_ImplSoftRaster_GetFramebuffer(int* out_width, int* out_height)
+{
+    if (out_width) *out_width = g_FbWidth;
+    if (out_height) *out_height = g_FbHeight;
+    return g_FbPixels.Data;
+}
+
+// Copy glyphs added to the font atlas after Build() (ImFontAtlasFlags_DynamicGlyphs) into our texture.
+static void ImGui_ImplSoftRaster_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    int x, y, w, h;
+    if (g_FontTexture.Pixels == NULL || !atlas->GetTexDataDirtyRect(&x, &y, &w, &h))
+        return;
+    unsigned char* pixels;
+    int width, height;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    if (width != g_FontTexture.Width || height != g_FontTexture.Height)
+    {
+        // Atlas texture grew: copy it whole. The texture struct used as ImTextureID stays the same.
+        g_FontPixels.resize(width * height);
+        memcpy(g_FontPixels.Data, pixels, (size_t)g_FontPixels.size_in_bytes());
+        g_FontTexture.Pixels = g_FontPixels.Data;
+        g_FontTexture.Width = width;
+        g_FontTexture.Height = height;
+    }
+    else
+    {
+        for (int row = y; row < y + h; row++)
+            memcpy(&g_FontPixels[row * width + x], pixels + ((size_t)row * width + x) * 4, (size_t)w * 4);
+    }
+    atlas->ClearTexDataDirtyRect();
+}
+
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+    ImGui_ImplSoftRaster_UpdateFontsTexture();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    g_FontSdfSlope = (atlas->Flags & ImFontAtlasFlags_SDF) ? 128.0f / (atlas->TexSdfSpread * 255.0f) : 0.0f;
+    if (fb_width != g_FbWidth || fb_height != g_FbHeight)
+        ImGui_ImplSoftRaster_Clear(fb_width, fb_height, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
+    g_TilesX = (g_FbWidth + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    g_TilesY = (g_FbHeight + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    g_DrawData = draw_data;
+
+    // Gather commands into batches, flushing them whenever a user callback needs to run in order
+    int tris_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state. We have none.)
+                ImGui_ImplSoftRaster_FlushBatches(tris_count);
+                tris_count = 0;
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+            }
+            else if (pcmd->ElemCount > 0)
+            {
+                ImGui_ImplSoftRaster_Batch batch = { cmd_list, pcmd, tris_count };
+                g_Batches.push_back(batch);
+                tris_count += (int)pcmd->ElemCount / 3;
+            }
+        }
+    }
+    ImGui_ImplSoftRaster_FlushBatches(tris_count);
+    g_DrawData = NULL;
+}
+
+bool    ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    // Build texture atlas
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+
+    // Keep our own copy so the atlas is free to release its CPU-side data
+    g_FontPixels.resize(width * height);
+    memcpy(g_FontPixels.Data, pixels, (size_t)g_FontPixels.size_in_bytes());
+    g_FontTexture.Pixels = g_FontPixels.Data;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+    io.Fonts->ClearTexDataDirtyRect();
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)&g_FontTexture);
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    if (g_FontTexture.Pixels)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.Fonts->SetTexID(0);
+        g_FontPixels.clear();
+        g_FontTexture.Pixels = NULL;
+        g_FontTexture.Width = g_FontTexture.Height = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// PNG export
+//-----------------------------------------------------------------------------
+// Minimal zlib stream: fixed Huffman codes and a greedy single-candidate LZ77 match finder.
+// UI framebuffers are mostly flat colors and repeated glyphs, which this compresses well enough.
+
+struct ImGui_ImplSoftRaster_BitWriter
+{
+    ImVector<unsigned char> Out;
+    unsigned int            Bits;
+    int                     BitsCount;
+
+    ImGui_ImplSoftRaster_BitWriter() { Bits = 0; BitsCount = 0; }
+    void Write(unsigned int value, int count)   // LSB first
+    {
+        Bits |= value << BitsCount;
+        BitsCount += count;
+        while (BitsCount >= 8)
+        {
+            Out.push_back((unsigned char)(Bits & 0xFF));
+            Bits >>= 8;
+            BitsCount -= 8;
+        }
+    }
+    void WriteHuffman(unsigned int code, int count) // Huffman codes are stored MSB first
+    {
+        unsigned int rev = 0;
+        for (int n = 0; n < count; n++)
+            rev |= ((code >> n) & 1) << (count - 1 - n);
+        Write(rev, count);
+    }
+    void Flush() { if (BitsCount > 0) Write(0, 8 - BitsCount); }
+};
+
+static void ImGui_ImplSoftRaster_WriteLiteral(ImGui_ImplSoftRaster_BitWriter& bw, unsigned int lit)
+{
+    if (lit <= 143)      bw.WriteHuffman(0x30 + lit, 8);
+    else if (lit <= 255) bw.WriteHuffman(0x190 + lit - 144, 9);
+    else if (lit <= 279) bw.WriteHuffman(lit - 256, 7);
+    else                 bw.WriteHuffman(0xC0 + lit - 280, 8);
+}
+
+static void ImGui_ImplSoftRaster_Deflate(ImVector<unsigned char>& out, const unsigned char* data, int data_size)
+{
+    static const unsigned short len_base[] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+    static const unsigned char  len_extra[] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+    static const unsigned short dist_base[] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+    static const unsigned char  dist_extra[] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+    const int hash_bits = 15, window = 32768, max_match = 258;
+
+    ImGui_ImplSoftRaster_BitWriter bw;
+    bw.Out.reserve(data_size / 8 + 64);
+    bw.Write(0x78, 8); bw.Write(0x01, 8);   // zlib header: deflate, 32K window, no dictionary
+    bw.Write(1, 1);                         // BFINAL
+    bw.Write(1, 2);                         // BTYPE = fixed Huffman
+
+    ImVector<int> head;
+    head.resize(1 << hash_bits, -1);
+    int pos = 0;
+    while (pos < data_size)
+    {
+        int best_len = 0, best_dist = 0;
+        if (pos + 3 <= data_size)
+        {
+            unsigned int h = ((unsigned int)data[pos] << 16 | (unsigned int)data[pos + 1] << 8 | data[pos + 2]) * 2654435761u >> (32 - hash_bits);
+            int cand = head[(int)h];
+            head[(int)h] = pos;
+            if (cand >= 0 && pos - cand <= window)
+            {
+                const int limit = ImGui_ImplSoftRaster_Min(max_match, data_size - pos);
+                int len = 0;
+                while (len < limit && data[cand + len] == data[pos + len])
+                    len++;
+                if (len >= 3)
+                {
+                    best_len = len;
+                    best_dist = pos - cand;
+                }
+            }
+        }
+        if (best_len == 0)
+        {
+            ImGui_ImplSoftRaster_WriteLiteral(bw, data[pos++]);
+            continue;
+        }
+        int code = 0;
+        while (code + 1 < IM_ARRAYSIZE(len_base) && len_base[code + 1] <= best_len)
+            code++;
+        ImGui_ImplSoftRaster_WriteLiteral(bw, 257 + code);
+        bw.Write(best_len - len_base[code], len_extra[code]);
+        code = 0;
+        while (code + 1 < IM_ARRAYSIZE(dist_base) && dist_base[code + 1] <= best_dist)
+            code++;
+        bw.WriteHuffman(code, 5);
+        bw.Write(best_dist - dist_base[code], dist_extra[code]);
+        pos += best_len;
+    }
+    ImGui_ImplSoftRaster_WriteLiteral(bw, 256);
+    bw.Flush();
+
+    unsigned int s1 = 1, s2 = 0;
+    for (int n = 0; n < data_size; n++)
+    {
+        s1 = (s1 + data[n]) % 65521;
+        s2 = (s2 + s1) % 65521;
+    }
+    unsigned int adler = (s2 << 16) | s1;
+    for (int shift = 24; shift >= 0; shift -= 8)
+        bw.Out.push_back((unsigned char)(adler >> shift));
+    out.swap(bw.Out);
+}
+
+static unsigned int ImGui_ImplSoftRaster_Crc32(unsigned int crc, const unsigned char* data, int data_size)
+{
+    crc = ~crc;
+    for (int n = 0; n < data_size; n++)
+    {
+        crc ^= data[n];
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static bool ImGui_ImplSoftRaster_WriteChunk(FILE* f, const char* type, const unsigned char* data, int data_size)
+{
+    unsigned char header[8] = { (unsigned char)(data_size >> 24), (unsigned char)(data_size >> 16), (unsigned char)(data_size >> 8), (unsigned char)data_size, 0, 0, 0, 0 };
+    memcpy(header + 4, type, 4);
+    unsigned int crc = ImGui_ImplSoftRaster_Crc32(ImGui_ImplSoftRaster_Crc32(0, header + 4, 4), data, data_size);
+    unsigned char footer[4] = { (unsigned char)(crc >> 24), (unsigned char)(crc >> 16), (unsigned char)(crc >> 8), (unsigned char)crc };
+    return fwrite(header, 1, 8, f) == 8 && (data_size == 0 || fwrite(data, 1, (size_t)data_size, f) == (size_t)data_size) && fwrite(footer, 1, 4, f) == 4;
+}
+
+bool    ImGui_ImplSoftRaster_SavePNG(const char* filename)
+{
+    if (g_FbWidth <= 0 || g_FbHeight <= 0)
+        return false;
+
+    // Scanlines in RGBA8 byte order, each prefixed with filter type 0 (none)
+    const int stride = g_FbWidth * 4 + 1;
+    ImVector<unsigned char> raw;
+    raw.resize(stride * g_FbHeight);
+    for (int y = 0; y < g_FbHeight; y++)
+    {
+        unsigned char* dst = &raw[y * stride];
+        *dst++ = 0;
+        const ImU32* src = &g_FbPixels.Data[y * g_FbWidth];
+        for (int x = 0; x < g_FbWidth; x++, dst += 4)
+        {
+            dst[0] = (unsigned char)(src[x] >> IM_COL32_R_SHIFT);
+            dst[1] = (unsigned char)(src[x] >> IM_COL32_G_SHIFT);
+            dst[2] = (unsigned char)(src[x] >> IM_COL32_B_SHIFT);
+            dst[3] = (unsigned char)(src[x] >> IM_COL32_A_SHIFT);
+        }
+    }
+    ImVector<unsigned char> idat;
+    ImGui_ImplSoftRaster_Deflate(idat, raw.Data, raw.Size);
+
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return false;
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    const unsigned char ihdr[13] =
+    {
+        (unsigned char)(g_FbWidth >> 24), (unsigned char)(g_FbWidth >> 16), (unsigned char)(g_FbWidth >> 8), (unsigned char)g_FbWidth,
+        (unsigned char)(g_FbHeight >> 24), (unsigned char)(g_FbHeight >> 16), (unsigned char)(g_FbHeight >> 8), (unsigned char)g_FbHeight,
+        8, 6, 0, 0, 0   // 8 bits per channel, RGBA, deflate, adaptive filtering, no interlace
+    };
+    bool ok = fwrite(signature, 1, 8, f) == 8;
+    ok = ok && ImGui_ImplSoftRaster_WriteChunk(f, "IHDR", ihdr, 13);
+    ok = ok && ImGui_ImplSoftRaster_WriteChunk(f, "IDAT", idat.Data, idat.Size);
+    ok = ok && ImGui_ImplSoftRaster_WriteChunk(f, "IEND", NULL, 0);
+    fclose(f);
+    return ok;
+}
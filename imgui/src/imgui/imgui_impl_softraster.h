@@ -0,0 +1,56 @@
+// dear imgui: Renderer for CPU software rasterization into an in-memory RGBA framebuffer
+// - No GPU, OpenGL context or window required: suitable for headless screenshots and CI performance runs.
+// This needs to be used along with a Platform Binding (e.g. GLFW), or with io.DisplaySize/io.DeltaTime filled by hand when headless.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile binning and rasterization. SSE2 span filling for flat colored triangles.
+//  [X] Renderer: PNG export of the framebuffer.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+// About rasterization rules:
+//  Triangles are sampled at pixel centers with a top-left fill rule, so the two triangles of a quad never blend a pixel twice.
+//  Blending matches the OpenGL3 back-end: src * src_alpha + dst * (1 - src_alpha), applied to all four channels.
+//  Textures are sampled with nearest filtering, which is exact for the font atlas since glyphs are pixel aligned.
+//  A font atlas built with ImFontAtlasFlags_SDF is filtered bilinearly and thresholded, like the OpenGL3 back-end shader does.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture as seen by the software renderer. Pass a pointer to one of these as ImTextureID (e.g. to ImGui::Image()).
+// Pixels are RGBA32, packed the same way as IM_COL32(). The renderer does not take ownership of the pixels.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*    Pixels;
+    int             Width;
+    int             Height;
+};
+
+// Backend API
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);  // 0: use all hardware threads
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data);
+
+// Framebuffer access
+// - Clear() resizes the framebuffer if needed, RenderDrawData() will also resize it to the draw data display size.
+// - Pixels are RGBA32 packed the same way as IM_COL32(), rows are tightly packed, top row first.
+IMGUI_IMPL_API void         ImGui_ImplSoftRaster_Clear(int width, int height, const ImVec4& color);
+IMGUI_IMPL_API const ImU32* ImGui_ImplSoftRaster_GetFramebuffer(int* out_width, int* out_height);
+IMGUI_IMPL_API bool         ImGui_ImplSoftRaster_SavePNG(const char* filename);
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
+
+// Tile size in pixels for binning. Each tile is rasterized by a single thread, in submission order.
+#ifndef IMGUI_IMPL_SOFTRASTER_TILE_SIZE
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE     64
+#endif
+#ifndef IMGUI_IMPL_SOFTRASTER_MAX_THREADS
+#define IMGUI_IMPL_SOFTRASTER_MAX_THREADS   32
+#endif
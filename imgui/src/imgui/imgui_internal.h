@@ -48,6 +48,12 @@ Index of this file:
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
 
+// Enable SSE2 intrinsics if available (always the case on x86-64)
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_ENABLE_SSE
+#include <emmintrin.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -110,6 +116,7 @@ struct ImGuiTable;                  // Storage for a table
 struct ImGuiTableColumn;            // Storage for one column of a table
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextSizeCacheEntry;     // Text size measured by CalcTextSize(), kept for the following calls with the same text
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
@@ -246,6 +253,7 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImFrameArena
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
@@ -563,7 +571,7 @@ struct IMGUI_API ImPool
     ImPoolIdx   GetIndex(const T* p) const          { IM_ASSERT(p >= Buf.Data && p < Buf.Data + Buf.Size); return (ImPoolIdx)(p - Buf.Data); }
     T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return &Buf[*p_idx]; *p_idx = FreeIdx; return Add(); }
     bool        Contains(const T* p) const          { return (p >= Buf.Data && p < Buf.Data + Buf.Size); }
-    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { int idx = Map.Data[n].val_i; if (idx != -1) Buf[idx].~T(); } Map.Clear(); Buf.clear(); FreeIdx = 0; }
+    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { if (!Map.IsPairValid(n)) continue; int idx = Map.Data[n].val_i; if (idx != -1) Buf[idx].~T(); } Map.Clear(); Buf.clear(); FreeIdx = 0; }
     T*          Add()                               { int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); return &Buf[idx]; }
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
     void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); }
@@ -593,6 +601,32 @@ struct IMGUI_API ImChunkStream
     T*      ptr_from_offset(int off)    { IM_ASSERT(off >= 4 && off < Buf.Size); return (T*)(void*)(Buf.Data + off); }
 };
 
+// Helper: ImFrameArena
+// Linear allocator for transient buffers which don't outlive the frame they were allocated in. See ImGui::MemAllocFrame().
+// Blocks are taken from MemAlloc() and rewound by Reset() at the start of every frame. When a frame needed more than one block,
+// Reset() replaces them with a single block of the combined size, so the following frames don't allocate anymore.
+struct ImFrameArenaBlock
+{
+    char*   Data;
+    int     Size;
+};
+
+struct IMGUI_API ImFrameArena
+{
+    ImVector<ImFrameArenaBlock> Blocks;         // Allocations are served from Blocks.back()
+    int                         BlockUsed;      // Bytes used in Blocks.back()
+    int                         UsedBytes;      // Bytes allocated since the last Reset()
+    int                         UsedBytesPreviousFrame;
+
+    ImFrameArena()      { BlockUsed = UsedBytes = UsedBytesPreviousFrame = 0; }
+    ~ImFrameArena()     { Clear(); }
+    void*   Alloc(size_t size)  { size = (size + 15) & ~(size_t)15; if (Blocks.Size == 0 || (size_t)BlockUsed + size > (size_t)Blocks.back().Size) AddBlock(size); void* p = Blocks.back().Data + BlockUsed; BlockUsed += (int)size; UsedBytes += (int)size; return p; }
+    void    AddBlock(size_t min_size);
+    void    Reset();
+    void    Clear();
+    int     GetReservedBytes() const { int sz = 0; for (int n = 0; n < Blocks.Size; n++) sz += Blocks[n].Size; return sz; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -630,7 +664,7 @@ struct IMGUI_API ImDrawListSharedData
 
 struct ImDrawDataBuilder
 {
-    ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
+    ImVector<ImDrawList*>   Layers[3];           // Global layers for: regular, popups of worker contexts, tooltip
 
     void Clear()            { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].resize(0); }
     void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); }
@@ -989,7 +1023,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasSizeConstraint  = 1 << 4,
     ImGuiNextWindowDataFlags_HasFocus           = 1 << 5,
     ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
-    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7
+    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7,
+    ImGuiNextWindowDataFlags_HasContentVersion  = 1 << 8
 };
 
 // Storage for SetNexWindow** functions
@@ -1009,6 +1044,7 @@ struct ImGuiNextWindowData
     ImGuiSizeCallback           SizeCallback;
     void*                       SizeCallbackUserData;
     float                       BgAlphaVal;             // Override background alpha
+    ImU32                       ContentVersionVal;
     ImVec2                      MenuBarOffsetMinVal;    // *Always on* This is not exposed publicly, so we don't clear it.
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -1049,6 +1085,31 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Size of the CalcTextSize() cache, in entries (power of two). Define as 0 to disable the cache.
+#ifndef IMGUI_TEXT_SIZE_CACHE_SIZE
+#define IMGUI_TEXT_SIZE_CACHE_SIZE      4096
+#endif
+
+// Texts shorter than this are measured directly, as that is cheaper than hashing them and looking them up.
+#ifndef IMGUI_TEXT_SIZE_CACHE_MIN_LEN
+#define IMGUI_TEXT_SIZE_CACHE_MIN_LEN   8
+#endif
+
+// Storage for CalcTextSize(). Entries are direct-mapped from their key, a newer text replaces an older one.
+// The 64-bit key hashes the text along with everything the measure depends on (font, font size, wrap width, ImFontAtlas::TexGlyphsGeneration),
+// so entries don't need to be invalidated: they simply stop matching. All but the text contents are also stored and compared on lookup,
+// so a key collision can only return the size of another text of the same length, measured with the same parameters.
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64           Key;                // 0: unused
+    const ImFont*   Font;
+    float           FontSize;
+    float           WrapWidth;
+    int             TextLength;
+    unsigned int    TexGlyphsGeneration;
+    ImVec2          Size;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Columns support
 //-----------------------------------------------------------------------------
@@ -1191,6 +1252,7 @@ struct ImGuiContext
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     ImGuiID                 TestEngineHookIdInfo;               // Will call test engine hooks: ImGuiTestEngineHook_IdInfo() from GetID()
     void*                   TestEngine;                         // Test engine user data
+    ImGuiContext*           ParentContext;                      // Set for worker contexts (see CreateWorkerContext()), which only borrow the parent font atlas and inputs
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -1308,6 +1370,8 @@ struct ImGuiContext
     // Render
     ImDrawData              DrawData;                           // Main ImDrawData instance to pass render information to the user
     ImDrawDataBuilder       DrawDataBuilder;
+    ImVector<ImGuiContext*> WorkerContextsToMerge;              // Worker contexts whose draw lists are added to this frame, see MergeWorkerFrame()
+    int                     DrawDataOverlayStart;               // Index of the first draw list of tooltips, popups or the foreground in DrawData.CmdLists[]. Those of workers are drawn above the windows of their parent.
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
@@ -1400,6 +1464,14 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
+    ImVector<ImGuiTextSizeCacheEntry> TextSizeCache;            // CalcTextSize() cache, allocated on first use
+    int                     TextSizeCacheHits;                  // CalcTextSize() calls answered from the cache this frame
+    int                     TextSizeCacheMisses;
+    int                     TextSizeCacheHitsPreviousFrame;
+    int                     TextSizeCacheMissesPreviousFrame;
+    ImFrameArena            FrameArena;                         // Transient allocations, rewound by NewFrame(). See MemAllocFrame().
+    int                     FrameAllocations;                   // MemAlloc() calls this frame, for io.MetricsFrameAllocations
+    ImGuiMemTag             MemTag;                             // Tag of the allocations made with this context, see ImGuiMemTagScope
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
     {
@@ -1415,6 +1487,7 @@ struct ImGuiContext
         TestEngineHookItems = false;
         TestEngineHookIdInfo = 0;
         TestEngine = NULL;
+        ParentContext = NULL;
 
         WindowsActiveCount = 0;
         CurrentWindow = NULL;
@@ -1486,6 +1559,7 @@ struct ImGuiContext
         FocusRequestNextCounterRegular = FocusRequestNextCounterTabStop = INT_MAX;
         FocusTabPressed = false;
 
+        DrawDataOverlayStart = 0;
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
@@ -1540,10 +1614,29 @@ struct ImGuiContext
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        TextSizeCacheHits = TextSizeCacheMisses = TextSizeCacheHitsPreviousFrame = TextSizeCacheMissesPreviousFrame = 0;
+        FrameAllocations = 0;
+        MemTag = ImGuiMemTag_Misc;
         memset(TempBuffer, 0, sizeof(TempBuffer));
     }
 };
 
+// Attribute allocations made with the current context to 'tag' until the end of the scope, e.g. IM_MEMTAG_SCOPE(ImGuiMemTag_Tables).
+// Nested scopes override outer ones. Allocations outside of any scope are counted as ImGuiMemTag_Misc.
+// Keep scopes off per-primitive and per-window paths: e.g. ImDrawList only opens one when a buffer has to grow.
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+struct ImGuiMemTagScope
+{
+    ImGuiContext*   Ctx;
+    ImGuiMemTag     BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag)   { Ctx = GImGui; BackupTag = Ctx ? Ctx->MemTag : ImGuiMemTag_Misc; if (Ctx) Ctx->MemTag = tag; }
+    ~ImGuiMemTagScope()                 { if (Ctx) Ctx->MemTag = BackupTag; }
+};
+#define IM_MEMTAG_SCOPE(_TAG)   ImGuiMemTagScope im_memtag_scope(_TAG)
+#else
+#define IM_MEMTAG_SCOPE(_TAG)   ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
 //-----------------------------------------------------------------------------
@@ -1643,6 +1736,24 @@ struct IMGUI_API ImGuiWindowTempData
     }
 };
 
+// Storage for SetNextWindowContentVersion(): state of the frame which built the contents held in the window draw list.
+// The draw list is reused on a later frame only if everything here still matches.
+struct ImGuiWindowRetainedData
+{
+    ImU32                   Version;
+    int                     IdleBuilds;             // Consecutive builds while idle with the same state. Reused from 2: one build lets new items (tables, child windows) settle.
+    bool                    Focused;                // Window was part of the focused (nav) window hierarchy
+    ImVec2                  Pos;
+    ImVec2                  Size;
+    ImVec2                  Scroll;
+    ImRect                  InnerClipRect;
+    ImFont*                 Font;
+    float                   FontSize;
+    unsigned int            FontGlyphsGeneration;   // Glyphs added to the atlas since (ImFontAtlasFlags_DynamicGlyphs) may replace fallback glyphs in our text
+
+    ImGuiWindowRetainedData() { memset(this, 0, sizeof(*this)); }
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -1675,6 +1786,7 @@ struct IMGUI_API ImGuiWindow
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
+    bool                    ContentRetained;                    // Set when the draw list of the previous frame is reused as-is (see SetNextWindowContentVersion()). Begin() returned false.
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
@@ -1717,8 +1829,10 @@ struct IMGUI_API ImGuiWindow
     float                   FontWindowScale;                    // User scale multiplier per-window, via SetWindowFontScale()
     int                     SettingsOffset;                     // Offset into SettingsWindows[] (offsets are always valid as we only grow the array from the back)
 
-    ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
+    ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer). When using content versions, alternates with DrawListSpare.
     ImDrawList              DrawListInst;
+    ImDrawList*             DrawListSpare;                      // Second draw list, only allocated for windows using SetNextWindowContentVersion(): new contents are built in one while the other keeps the previous frame.
+    ImGuiWindowRetainedData Retained;
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window == Top-level window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1867,6 +1981,7 @@ struct ImGuiTableColumn
     float                   WidthStretchWeight;             // Master width weight when (Flags & _WidthStretch). Often around ~1.0f initially.
     float                   WidthRequest;                   // Master width absolute value when !(Flags & _WidthStretch). When Stretch this is derived every frame from WidthStretchWeight in TableUpdateLayout()
     float                   WidthGiven;                     // Final/actual width visible == (MaxX - MinX), locked in TableUpdateLayout(). May be >WidthRequest to honor minimum width, may be <WidthRequest to honor shrinking columns down in tight space.
+    float                   WidthGivenUnclamped;            // WidthGiven as computed by the last width pass, before TableUpdateLayout() shrinks it to keep columns visible. Reused while the layout isn't dirty.
     float                   StartXRows;                     // Start position for the frame, currently ~(MinX + CellPaddingX)
     float                   StartXHeaders;
     float                   ContentMaxPosRowsFrozen;        // Submitted contents absolute maximum position, from which we can infer width.
@@ -1897,7 +2012,7 @@ struct ImGuiTableColumn
     ImGuiTableColumn()
     {
         memset(this, 0, sizeof(*this));
-        WidthStretchWeight = WidthRequest = WidthGiven = -1.0f;
+        WidthStretchWeight = WidthRequest = WidthGiven = WidthGivenUnclamped = -1.0f;
         NameOffset = -1;
         IsVisible = IsVisibleNextFrame = true;
         DisplayOrder = IndexWithinVisibleSet = -1;
@@ -1945,6 +2060,10 @@ struct ImGuiTable
     ImGuiTableRowFlags          RowFlags : 16;              // Current row flags, see ImGuiTableRowFlags_
     ImGuiTableRowFlags          LastRowFlags : 16;
     int                         RowBgColorCounter;          // Counter for alternating background colors (can be fast-forwarded by e.g clipper)
+    int                         HostDrawCmdStart;           // First command of the host draw list that only holds table output (CmdBuffer.Size when splitting, minus 1 if the current command was empty)
+    int                         LastDrawChannelsCount;      // [Metrics] Draw channels used by the table, including the background channel
+    int                         LastDrawCmdCount;           // [Metrics] Draw commands output by the table, after merging draw channels
+    int                         LastDrawMergeBytes;         // [Metrics] Bytes of commands and indices copied when merging draw channels
     ImU32                       RowBgColor[2];              // Background color override for current row.
     ImU32                       BorderColorStrong;
     ImU32                       BorderColorLight;
@@ -1962,6 +2081,10 @@ struct ImGuiTable
     float                       ColumnsAutoFitWidth;        // Sum of ideal column width in order nothing to be clipped, used for auto-fitting and content width submission in outer window
     float                       ResizedColumnNextWidth;
     float                       RefScale;                   // Reference scale to be able to rescale columns on font/dpi changes.
+    float                       LayoutWidthAvail;           // Inputs of the last full TableUpdateLayout() width pass, to detect when its results can be reused
+    float                       LayoutMinColumnWidth;
+    float                       LayoutCellPaddingX;
+    ImGuiTableFlags             LayoutFlags;
     ImRect                      OuterRect;                  // Note: OuterRect.Max.y is often FLT_MAX until EndTable(), unless a height has been specified in BeginTable().
     ImRect                      WorkRect;
     ImRect                      InnerClipRect;
@@ -1969,6 +2092,7 @@ struct ImGuiTable
     ImRect                      HostClipRect;               // This is used to check if we can eventually merge our columns draw calls into the current draw call of the current window.
     ImRect                      HostBackupParentWorkRect;   // Backup of InnerWindow->ParentWorkRect at the end of BeginTable()
     ImRect                      HostBackupClipRect;         // Backup of InnerWindow->ClipRect during PushTableBackground()/PopTableBackground()
+    ImVec4                      HostBackupCullRect;         // Backup of InnerWindow->DrawList->_CullRect while the draw channels are split
     ImVec2                      HostCursorMaxPos;           // Backup of InnerWindow->DC.CursorMaxPos at the end of BeginTable()
     ImVec1                      HostBackupColumnsOffset;    // Backup of OuterWindow->ColumnsOffset at the end of BeginTable()
     ImGuiWindow*                OuterWindow;                // Parent window for the table
@@ -1999,6 +2123,7 @@ struct ImGuiTable
     bool                        IsInsideRow;                // Set when inside TableBeginRow()/TableEndRow().
     bool                        IsInitializing;
     bool                        IsSortSpecsDirty;
+    bool                        IsLayoutDirty;              // Set when columns widths need to be recomputed by TableUpdateLayout() (resize, reorder, hide, flags or contents width change).
     bool                        IsUsingHeaders;             // Set when the first row had the ImGuiTableRowFlags_Headers flag.
     bool                        IsContextPopupOpen;         // Set when default context menu is open (also see: ContextPopupColumn, InstanceInteracted).
     bool                        IsSettingsRequestLoad;
@@ -2104,6 +2229,9 @@ namespace ImGui
     IMGUI_API void          Initialize(ImGuiContext* context);
     IMGUI_API void          Shutdown(ImGuiContext* context);    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
 
+    // Memory
+    IMGUI_API void*         MemAllocFrame(size_t size);         // Transient memory from the current context frame arena, 16 bytes aligned. Valid until the next NewFrame(), never freed by the caller.
+
     // NewFrame
     IMGUI_API void          UpdateHoveredWindowAndCaptureFlags();
     IMGUI_API void          StartMouseMovingWindow(ImGuiWindow* window);
@@ -2355,7 +2483,7 @@ namespace ImGui
     IMGUI_API void          ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags flags);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size, const ImGuiPlotPyramid* pyramid = NULL);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -2377,6 +2505,11 @@ IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildGrowTexture(ImFontAtlas* atlas, int min_height);
+IMGUI_API ImU32             ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename, ImU32 key);
+IMGUI_API bool              ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename, ImU32 key);
 IMGUI_API void              ImFontAtlasBuildRender1bppRectFromString(ImFontAtlas* atlas, int atlas_x, int atlas_y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
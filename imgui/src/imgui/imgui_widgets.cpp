@@ -47,6 +47,7 @@ Index of this file:
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#include <limits>       // std::numeric_limits
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -259,6 +260,14 @@ void ImGui::TextV(const char* fmt, va_list args)
     if (window->SkipItems)
         return;
 
+    // Text("%s", str) is a common idiom: display the string directly instead of copying it
+    if (fmt[0] == '%' && fmt[1] == 's' && fmt[2] == 0)
+    {
+        const char* text = va_arg(args, const char*);
+        TextEx(text ? text : "(null)", NULL, ImGuiTextFlags_NoWidthForLargeClippedText);
+        return;
+    }
+
     ImGuiContext& g = *GImGui;
     const char* text_end = g.TempBuffer + ImFormatStringV(g.TempBuffer, IM_ARRAYSIZE(g.TempBuffer), fmt, args);
     TextEx(g.TempBuffer, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
@@ -4137,10 +4146,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
+                char* clipboard_data = (char*)MemAllocFrame(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4156,7 +4164,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s; )
                 {
@@ -4174,7 +4182,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4196,13 +4203,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Push records into the undo stack so we can CTRL+Z the revert operation itself
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
-                ImVector<ImWchar> w_text;
+                ImWchar* w_text = NULL;
+                int w_text_len = 0;
                 if (apply_new_text_length > 0)
                 {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text_len = ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text = (ImWchar*)MemAllocFrame((w_text_len + 1) * sizeof(ImWchar));
+                    ImTextStrFromUtf8(w_text, w_text_len + 1, apply_new_text, apply_new_text + apply_new_text_length);
                 }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, w_text, w_text_len);
             }
         }
 
@@ -6191,12 +6200,53 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
+// - ImGuiPlotPyramid
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
+void ImGuiPlotPyramid::Build(const float* values, int values_count, int stride)
+{
+    IM_ASSERT(values_count >= 0);
+    ValuesCount = values_count;
+    LevelsOffset.resize(0);
+    int blocks_total = 0;
+    for (int blocks_count = values_count; blocks_count > 0; blocks_count = (blocks_count > 1) ? (blocks_count + 1) / 2 : 0)
+    {
+        LevelsOffset.push_back(blocks_total);
+        blocks_total += blocks_count;
+    }
+    Blocks.resize(blocks_total);
+    if (values_count == 0)
+        return;
+
+    ImVec2* blocks = Blocks.Data;
+    for (int n = 0; n < values_count; n++)
+    {
+        const float v = *(const float*)(const void*)((const unsigned char*)values + (size_t)n * stride);
+        blocks[n] = (v != v) ? ImVec2(FLT_MAX, -FLT_MAX) : ImVec2(v, v); // Ignore NaN values
+    }
+    for (int level = 1; level < LevelsOffset.Size; level++)
+    {
+        const ImVec2* src = Blocks.Data + LevelsOffset[level - 1];
+        ImVec2* dst = Blocks.Data + LevelsOffset[level];
+        const int src_count = GetBlocksCount(level - 1);
+        for (int n = 0; n + 1 < src_count; n += 2)
+            dst[n >> 1] = ImVec2(ImMin(src[n].x, src[n + 1].x), ImMax(src[n].y, src[n + 1].y));
+        if (src_count & 1)
+            dst[src_count >> 1] = src[src_count - 1];
+    }
+}
+
+static float PlotPyramid_Getter(void* data, int idx)
+{
+    const ImVec2& block = ((const ImGuiPlotPyramid*)data)->Blocks[idx];
+    return (block.x <= block.y) ? block.x : std::numeric_limits<float>::quiet_NaN(); // Give NaN values back
+}
+
+// When 'pyramid' is set, 'values_getter' and 'data' must read its level 0 (e.g. PlotPyramid_Getter), and 'values_offset' must be 0.
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size, const ImGuiPlotPyramid* pyramid)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -6225,7 +6275,13 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (pyramid != NULL && pyramid->GetLevelsCount() > 0)
+        {
+            const ImVec2& top_block = pyramid->GetBlocks(pyramid->GetLevelsCount() - 1)[0];
+            v_min = top_block.x;
+            v_max = top_block.y;
+        }
+        else for (int i = 0; i < values_count; i++)
         {
             const float v = values_getter(data, i);
             if (v != v) // Ignore NaN values
@@ -6243,7 +6299,83 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
-    if (values_count >= values_count_min)
+    if (pyramid != NULL && values_count > (int)frame_size.x && inner_bb.GetWidth() >= 1.0f)
+    {
+        IM_ASSERT(values_offset == 0 && values_count == pyramid->ValuesCount);
+
+        // Pick the level with the largest blocks not wider than a column: each column then gathers one or two blocks
+        const int columns_count = (int)inner_bb.GetWidth();
+        const float column_w = inner_bb.GetWidth() / (float)columns_count;
+        int level = 0;
+        while (level + 1 < pyramid->GetLevelsCount() && ((ImS64)columns_count << (level + 1)) <= values_count)
+            level++;
+        const ImVec2* blocks = pyramid->GetBlocks(level);
+        const int blocks_count = pyramid->GetBlocksCount(level);
+
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+            column_hovered = ImClamp((int)((g.IO.MousePos.x - inner_bb.Min.x) / column_w), 0, columns_count - 1);
+
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+        ImDrawList* draw_list = window->DrawList;
+        draw_list->PathClear();
+        ImRect marker_bb; // Envelope of the hovered column in Lines mode (inverted when none)
+
+        // Blocks [n, block_end) of column c are those with n * columns_count / blocks_count == c
+        for (int column_n = 0, n = 0; column_n < columns_count; column_n++)
+        {
+            const int block_end = (int)(((ImS64)(column_n + 1) * blocks_count + columns_count - 1) / columns_count);
+            if (n == block_end)
+                continue;
+            const int v_idx = n << level;
+            ImVec2 env = blocks[n];
+            for (n++; n < block_end; n++)
+                env = ImVec2(ImMin(env.x, blocks[n].x), ImMax(env.y, blocks[n].y));
+            if (column_n == column_hovered)
+            {
+                const int v_idx_last = ImMin(n << level, values_count) - 1;
+                if (env.x <= env.y)
+                    SetTooltip("%d..%d: %8.4g..%8.4g", v_idx, v_idx_last, env.x, env.y);
+                else
+                    SetTooltip("%d..%d: -", v_idx, v_idx_last);
+                idx_hovered = v_idx;
+            }
+            if (env.x > env.y)
+                continue;
+
+            const float t_min = 1.0f - ImSaturate((env.x - scale_min) * inv_scale);
+            const float t_max = 1.0f - ImSaturate((env.y - scale_min) * inv_scale);
+            const float x0 = inner_bb.Min.x + column_n * column_w;
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                // Alternate the order of the envelope ends so the line joining two columns stays short on average
+                const float x = x0 + column_w * 0.5f;
+                const float y_min = ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_min);
+                const float y_max = ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_max);
+                draw_list->PathLineToMergeDuplicate(ImVec2(x, (column_n & 1) ? y_min : y_max));
+                draw_list->PathLineToMergeDuplicate(ImVec2(x, (column_n & 1) ? y_max : y_min));
+                if (column_n == column_hovered)
+                    marker_bb = ImRect(x, y_max, x, y_min);
+            }
+            else if (plot_type == ImGuiPlotType_Histogram)
+            {
+                const float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMin(t_max, histogram_zero_line_t));
+                const float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMax(t_min, histogram_zero_line_t));
+                draw_list->AddRectFilled(ImVec2(x0, y0), ImVec2(x0 + column_w, y1), column_n == column_hovered ? col_hovered : col_base);
+            }
+        }
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            // The hovered marker is drawn after stroking the path, as AddLine() builds its own path
+            draw_list->PathStroke(col_base, false);
+            if (marker_bb.Min.y <= marker_bb.Max.y)
+                draw_list->AddLine(ImVec2(marker_bb.Min.x, marker_bb.Min.y - 1.0f), ImVec2(marker_bb.Min.x, marker_bb.Max.y + 1.0f), col_hovered, 2.0f);
+        }
+    }
+    else if (values_count >= values_count_min)
     {
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
         int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
@@ -6351,6 +6483,16 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotPyramid& pyramid, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Lines, label, &PlotPyramid_Getter, (void*)&pyramid, pyramid.ValuesCount, 0, overlay_text, scale_min, scale_max, graph_size, &pyramid);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotPyramid& pyramid, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Histogram, label, &PlotPyramid_Getter, (void*)&pyramid, pyramid.ValuesCount, 0, overlay_text, scale_min, scale_max, graph_size, &pyramid);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -8302,6 +8444,7 @@ void ImGui::Columns(int columns_count, const char* id, bool border)
 // - TableSetupColumn()                         user submit columns details (optional)
 // - TableSetupScrollFreeze()                   user submit scroll freeze information (optional)
 // - TableUpdateLayout() [Internal]             automatically called by the FIRST call to TableNextRow() or Table*Header(): lock all widths, columns positions, clipping rectangles
+//    | TableUpdateColumnsWidth()               - compute columns widths (skipped when unchanged since last frame, see IsLayoutDirty)
 //    | TableUpdateDrawChannels()               - setup ImDrawList channels
 //    | TableUpdateBorders()                    - detect hovering columns for resize, ahead of contents submission
 //    | TableDrawContextMenu()                  - draw right-click context menu
@@ -8392,6 +8535,7 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
@@ -8436,6 +8580,8 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     // Initialize
     table->ID = id;
     table->Flags = flags;
+    if (flags != table->LayoutFlags)
+        table->IsLayoutDirty = true;
     table->InstanceCurrent = (ImS16)instance_no;
     table->LastFrameActive = g.FrameCount;
     table->OuterWindow = table->InnerWindow = outer_window;
@@ -8554,7 +8700,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
             table->Columns[n] = ImGuiTableColumn();
             table->Columns[n].DisplayOrder = table->DisplayOrderToIndex[n] = (ImS8)n;
         }
-        table->IsInitializing = table->IsSettingsRequestLoad = table->IsSortSpecsDirty = true;
+        table->IsInitializing = table->IsSettingsRequestLoad = table->IsSortSpecsDirty = table->IsLayoutDirty = true;
     }
 
     // Load settings
@@ -8573,6 +8719,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         //IMGUI_DEBUG_LOG("[table] %08X RefScaleUnit %.3f -> %.3f, scaling width by %.3f\n", table->ID, table->RefScaleUnit, new_ref_scale_unit, scale_factor);
         for (int n = 0; n < columns_count; n++)
             table->Columns[n].WidthRequest = table->Columns[n].WidthRequest * scale_factor;
+        table->IsLayoutDirty = true;
     }
     table->RefScale = new_ref_scale_unit;
 
@@ -8634,6 +8781,7 @@ void ImGui::TableBeginUpdateColumns(ImGuiTable* table)
                 table->DisplayOrderToIndex[table->Columns[column_n].DisplayOrder] = (ImS8)column_n;
             table->ReorderColumnDir = 0;
             table->IsSettingsDirty = true;
+            table->IsLayoutDirty = true;
         }
     }
 
@@ -8644,6 +8792,7 @@ void ImGui::TableBeginUpdateColumns(ImGuiTable* table)
             table->DisplayOrderToIndex[n] = table->Columns[n].DisplayOrder = (ImS8)n;
         table->IsResetDisplayOrderRequest = false;
         table->IsSettingsDirty = true;
+        table->IsLayoutDirty = true;
     }
 
     // Setup and lock Visible state and order
@@ -8664,6 +8813,7 @@ void ImGui::TableBeginUpdateColumns(ImGuiTable* table)
         {
             column->IsVisible = column->IsVisibleNextFrame;
             table->IsSettingsDirty = true;
+            table->IsLayoutDirty = true;
             if (!column->IsVisible && column->SortOrder != -1)
                 table->IsSortSpecsDirty = true;
         }
@@ -8698,6 +8848,8 @@ void ImGui::TableBeginUpdateColumns(ImGuiTable* table)
     }
     table->VisibleUnclippedMaskByIndex = table->VisibleMaskByIndex; // Columns will be masked out by TableUpdateLayout() when Clipped
     table->RightMostVisibleColumn = (ImS8)(last_visible_column ? table->Columns.index_from_ptr(last_visible_column) : -1);
+    if (want_column_auto_fit)
+        table->IsLayoutDirty = true;
 
     // Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible to avoid
     // the column fitting to wait until the first visible frame of the child container (may or not be a good thing).
@@ -8741,7 +8893,20 @@ void ImGui::TableUpdateDrawChannels(ImGuiTable* table)
     const int channels_for_background = 1;
     const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount || table->VisibleUnclippedMaskByIndex != table->VisibleMaskByIndex) ? +1 : 0;
     const int channels_total = channels_for_background + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
-    table->DrawSplitter.Split(table->InnerWindow->DrawList, channels_total);
+    // The current command goes to channel 0: when still empty it only holds table output after merging
+    ImDrawList* host_draw_list = table->InnerWindow->DrawList;
+    table->HostDrawCmdStart = host_draw_list->CmdBuffer.Size;
+    if (host_draw_list->CmdBuffer.Size > 0 && host_draw_list->CmdBuffer.back().ElemCount == 0 && host_draw_list->CmdBuffer.back().UserCallback == NULL)
+        table->HostDrawCmdStart--;
+    table->DrawSplitter.Split(host_draw_list, channels_total);
+
+    // TableReorderDrawChannelsForMerge() may enlarge the clip rect of column draw calls up to the host clip rect after they are drawn,
+    // so draw list culling uses the host clip rect until they are merged (joined with the one of an outer table drawing into the same list)
+    ImRect cull_rect = table->HostClipRect;
+    table->HostBackupCullRect = host_draw_list->_CullRect;
+    if (host_draw_list->_CullRect.x <= host_draw_list->_CullRect.z)
+        cull_rect.Add(ImRect(host_draw_list->_CullRect));
+    host_draw_list->_CullRect = cull_rect.ToVec4();
     table->DummyDrawChannel = channels_for_dummy ? (ImS8)(channels_total - 1) : -1;
 
     int draw_channel_current = 1;
@@ -8813,22 +8978,11 @@ static float TableGetMinColumnWidth()
     return g.Style.FramePadding.x * 3.0f;
 }
 
-// Layout columns for the frame
-// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
-// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for WidthAlwaysAutoResize
-// columns, increase feedback side-effect with widgets relying on WorkRect.Max.x. Maybe provide a default distribution
-// for WidthAlwaysAutoResize columns?
-void    ImGui::TableUpdateLayout(ImGuiTable* table)
+// Compute columns flags and widths (WidthRequest, WidthGiven) from contents width, user widths and weights.
+// Only depends on data which changes are either tracked with table->IsLayoutDirty or checked by TableUpdateLayout(),
+// so the results of a previous frame are reused as long as the table is left untouched.
+static void TableUpdateColumnsWidth(ImGuiTable* table, float width_avail, float width_spacings)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(table->IsLayoutLocked == false);
-
-    table->HoveredColumnBody = -1;
-    table->HoveredColumnBorder = -1;
-
-    // Compute offset, clip rect for the frame
-    // (can't make auto padding larger than what WorkRect knows about so right-alignment matches)
-    const ImRect work_rect = table->WorkRect;
     const float padding_auto_x = table->CellPaddingX2;
     const float min_column_width = TableGetMinColumnWidth();
 
@@ -8905,18 +9059,11 @@ void    ImGui::TableUpdateLayout(ImGuiTable* table)
     }
 
     // Layout
-    const float width_spacings = table->CellSpacingX * (table->ColumnsVisibleCount - 1);
-    float width_avail;
-    if ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f)
-        width_avail = table->InnerClipRect.GetWidth() - width_spacings;
-    else
-        width_avail = work_rect.GetWidth() - width_spacings;
     const float width_avail_for_stretched_columns = width_avail - sum_width_fixed_requests;
     float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
 
     // Apply final width based on requested widths
     // Mark some columns as not resizable
-    int count_resizable = 0;
     table->ColumnsTotalWidth = width_spacings;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
@@ -8945,9 +9092,6 @@ void    ImGui::TableUpdateLayout(ImGuiTable* table)
         if (column->NextVisibleColumn == -1 && table->LeftMostStretchedColumnDisplayOrder != -1)
             column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
 
-        if (!(column->Flags & ImGuiTableColumnFlags_NoResize))
-            count_resizable++;
-
         // Assign final width, record width in case we will need to shrink
         column->WidthGiven = ImFloor(ImMax(column->WidthRequest, min_column_width));
         table->ColumnsTotalWidth += column->WidthGiven;
@@ -8995,13 +9139,54 @@ void    ImGui::TableUpdateLayout(ImGuiTable* table)
             column->WidthGiven += 1.0f;
             width_remaining_for_stretched_columns -= 1.0f;
         }
+}
+
+// Layout columns for the frame
+// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
+// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for WidthAlwaysAutoResize
+// columns, increase feedback side-effect with widgets relying on WorkRect.Max.x. Maybe provide a default distribution
+// for WidthAlwaysAutoResize columns?
+void    ImGui::TableUpdateLayout(ImGuiTable* table)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(table->IsLayoutLocked == false);
+
+    table->HoveredColumnBody = -1;
+    table->HoveredColumnBorder = -1;
+
+    // Compute offset, clip rect for the frame
+    // (can't make auto padding larger than what WorkRect knows about so right-alignment matches)
+    const ImRect work_rect = table->WorkRect;
+    const float min_column_width = TableGetMinColumnWidth();
+
+    // Compute widths, unless nothing they depend on changed since last frame
+    const float width_spacings = table->CellSpacingX * (table->ColumnsVisibleCount - 1);
+    float width_avail;
+    if ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f)
+        width_avail = table->InnerClipRect.GetWidth() - width_spacings;
+    else
+        width_avail = work_rect.GetWidth() - width_spacings;
+    if (table->IsInitializing || width_avail != table->LayoutWidthAvail || min_column_width != table->LayoutMinColumnWidth || table->CellPaddingX2 != table->LayoutCellPaddingX)
+        table->IsLayoutDirty = true;
+    const bool update_widths = table->IsLayoutDirty;
+    if (update_widths)
+    {
+        TableUpdateColumnsWidth(table, width_avail, width_spacings);
+        table->LayoutWidthAvail = width_avail;
+        table->LayoutMinColumnWidth = min_column_width;
+        table->LayoutCellPaddingX = table->CellPaddingX2;
+        table->LayoutFlags = table->Flags;
+        table->IsLayoutDirty = false;
+    }
 
     // Detect hovered column
     const ImRect mouse_hit_rect(table->OuterRect.Min.x, table->OuterRect.Min.y, table->OuterRect.Max.x, ImMax(table->OuterRect.Max.y, table->OuterRect.Min.y + table->LastOuterHeight));
     const bool is_hovering_table = ItemHoverable(mouse_hit_rect, 0);
 
     // Setup final position, offset and clipping rectangles
+    // Mark some columns as not resizable
     int visible_n = 0;
+    int count_resizable = 0;
     float offset_x = (table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x;
     ImRect host_clip_rect = table->InnerClipRect;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
@@ -9043,8 +9228,15 @@ void    ImGui::TableUpdateLayout(ImGuiTable* table)
             if (!(table->Flags & ImGuiTableFlags_NoKeepColumnsVisible))
                 max_x = table->WorkRect.Max.x - (table->ColumnsVisibleCount - (column->IndexWithinVisibleSet + 1)) * min_column_width;
         }
+        // Shrink from the widths of the width pass, so a table kept shrunk reuses them instead of starting from the shrunk ones
+        if (update_widths)
+            column->WidthGivenUnclamped = column->WidthGiven;
+        else
+            column->WidthGiven = column->WidthGivenUnclamped;
         if (offset_x + column->WidthGiven > max_x)
             column->WidthGiven = ImMax(max_x - offset_x, min_column_width);
+        if (!(column->Flags & ImGuiTableColumnFlags_NoResize))
+            count_resizable++;
 
         column->MinX = offset_x;
         column->MaxX = column->MinX + column->WidthGiven;
@@ -9056,7 +9248,10 @@ void    ImGui::TableUpdateLayout(ImGuiTable* table)
         column->ClipRect.Max.y = FLT_MAX;
         column->ClipRect.ClipWithFull(host_clip_rect);
 
-        column->IsClipped = (column->ClipRect.Max.x <= column->ClipRect.Min.x) && (column->AutoFitQueue & 1) == 0 && (column->CannotSkipItemsQueue & 1) == 0;
+        const bool is_clipped = (column->ClipRect.Max.x <= column->ClipRect.Min.x) && (column->AutoFitQueue & 1) == 0 && (column->CannotSkipItemsQueue & 1) == 0;
+        if (column->IsClipped != is_clipped && (column->Flags & ImGuiTableColumnFlags_WidthAlwaysAutoResize))
+            table->IsLayoutDirty = true; // Auto-resizing columns stop updating their width while clipped
+        column->IsClipped = is_clipped;
         if (column->IsClipped)
             table->VisibleUnclippedMaskByIndex &= ~((ImU64)1 << column_n);  // Columns with the _WidthAlwaysAutoResize sizing policy will never be updated then.
 
@@ -9211,6 +9406,7 @@ void    ImGui::TableUpdateBorders(ImGuiTable* table)
 
 void    ImGui::EndTable()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
@@ -9275,10 +9471,15 @@ void    ImGui::EndTable()
         //float ref_x = column->MinX;
         float ref_x_rows = column->StartXRows - table->CellPaddingX1;
         float ref_x_headers = column->StartXHeaders - table->CellPaddingX1;
-        column->ContentWidthRowsFrozen = (ImS16)ImMax(0.0f, column->ContentMaxPosRowsFrozen - ref_x_rows);
-        column->ContentWidthRowsUnfrozen = (ImS16)ImMax(0.0f, column->ContentMaxPosRowsUnfrozen - ref_x_rows);
+        const ImS16 content_width_rows_frozen = (ImS16)ImMax(0.0f, column->ContentMaxPosRowsFrozen - ref_x_rows);
+        const ImS16 content_width_rows_unfrozen = (ImS16)ImMax(0.0f, column->ContentMaxPosRowsUnfrozen - ref_x_rows);
+        const ImS16 content_width_headers_ideal = (ImS16)ImMax(0.0f, column->ContentMaxPosHeadersIdeal - ref_x_headers);
+        if (column->ContentWidthRowsFrozen != content_width_rows_frozen || column->ContentWidthRowsUnfrozen != content_width_rows_unfrozen || column->ContentWidthHeadersIdeal != content_width_headers_ideal)
+            table->IsLayoutDirty = true;
+        column->ContentWidthRowsFrozen = content_width_rows_frozen;
+        column->ContentWidthRowsUnfrozen = content_width_rows_unfrozen;
         column->ContentWidthHeadersUsed = (ImS16)ImMax(0.0f, column->ContentMaxPosHeadersUsed - ref_x_headers);
-        column->ContentWidthHeadersIdeal = (ImS16)ImMax(0.0f, column->ContentMaxPosHeadersIdeal - ref_x_headers);
+        column->ContentWidthHeadersIdeal = content_width_headers_ideal;
 
         // Add an extra 1 pixel so we can see the last column vertical line if it lies on the right-most edge.
         if (table->VisibleMaskByIndex & ((ImU64)1 << column_n))
@@ -9289,7 +9490,24 @@ void    ImGui::EndTable()
     table->DrawSplitter.SetCurrentChannel(inner_window->DrawList, 0);
     if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
         TableReorderDrawChannelsForMerge(table);
+    table->LastDrawChannelsCount = table->DrawSplitter._Count;
     table->DrawSplitter.Merge(inner_window->DrawList);
+    inner_window->DrawList->_CullRect = table->HostBackupCullRect;
+
+    // Merge() leaves the channels as they were copied: trailing unused commands popped, and first commands merged into the previous channel emptied and skipped
+    table->LastDrawMergeBytes = 0;
+    for (int channel_n = 1; channel_n < table->LastDrawChannelsCount; channel_n++)
+    {
+        ImDrawChannel* channel = &table->DrawSplitter._Channels[channel_n];
+        int cmd_copied_count = channel->_CmdBuffer.Size;
+        if (cmd_copied_count > 0 && channel->_CmdBuffer[0].ElemCount == 0 && channel->_CmdBuffer[0].UserCallback == NULL)
+            cmd_copied_count--;
+        table->LastDrawMergeBytes += cmd_copied_count * (int)sizeof(ImDrawCmd) + channel->_IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+    }
+    table->LastDrawCmdCount = 0;
+    for (int cmd_n = table->HostDrawCmdStart; cmd_n < inner_window->DrawList->CmdBuffer.Size; cmd_n++)
+        if (inner_window->DrawList->CmdBuffer[cmd_n].ElemCount > 0)
+            table->LastDrawCmdCount++;
 
     // When releasing a column being resized, scroll to keep the resulting column in sight
     const float min_column_width = TableGetMinColumnWidth();
@@ -9507,6 +9725,7 @@ void ImGui::TableSetColumnWidth(ImGuiTable* table, ImGuiTableColumn* column_0, f
     // Compare both requested and actual given width to avoid overwriting requested width when column is stuck (minimum size, bounded)
     if (column_0->WidthGiven == column_0_width || column_0->WidthRequest == column_0_width)
         return;
+    table->IsLayoutDirty = true;
 
     ImGuiTableColumn* column_1 = (column_0->NextVisibleColumn != -1) ? &table->Columns[column_0->NextVisibleColumn] : NULL;
 
@@ -9761,6 +9980,7 @@ void    ImGui::TableReorderDrawChannelsForMerge(ImGuiTable* table)
 // Use a different API?
 void    ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, float init_width_or_weight, ImGuiID user_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Need to call TableSetupColumn() after BeginTable()!");
@@ -9777,10 +9997,14 @@ void    ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags,
         if ((table->Flags & ImGuiTableFlags_SizingPolicyFixedX) && (init_width_or_weight > 0.0f))
             flags |= ImGuiTableColumnFlags_WidthFixed;
 
+    // Keep the flags completed by TableUpdateLayout() (indent, resize rules) when its results are going to be reused
+    if (column->FlagsIn != flags)
+        table->IsLayoutDirty = true;
     column->UserID = user_id;
     column->FlagsIn = flags;
-    column->Flags = TableFixColumnFlags(table, column->FlagsIn);
-    flags = column->Flags;
+    flags = TableFixColumnFlags(table, column->FlagsIn);
+    if (table->IsLayoutDirty)
+        column->Flags = flags;
 
     // Initialize defaults
     if (flags & ImGuiTableColumnFlags_WidthStretch)
@@ -9789,6 +10013,8 @@ void    ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags,
         if (init_width_or_weight < 0.0f)
             init_width_or_weight = 1.0f;
     }
+    if (column->WidthOrWeightInitValue != init_width_or_weight)
+        table->IsLayoutDirty = true;
     column->WidthOrWeightInitValue = init_width_or_weight;
     if (table->IsInitializing && column->WidthRequest < 0.0f && column->WidthStretchWeight < 0.0f)
     {
@@ -10557,6 +10783,7 @@ void ImGui::TableSetColumnSortDirection(ImGuiTable* table, int column_n, ImGuiSo
 
     ImGuiTableColumn* column = &table->Columns[column_n];
     column->SortDirection = (ImS8)sort_direction;
+    table->IsLayoutDirty = true;
     if (column->SortOrder == -1 || !append_to_sort_specs)
         column->SortOrder = append_to_sort_specs ? sort_order_max + 1 : 0;
 
@@ -10867,6 +11094,7 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     table->IsSettingsRequestLoad = false;
+    table->IsLayoutDirty = true;
     if (table->Flags & ImGuiTableFlags_NoSavedSettings)
         return;
 
@@ -11037,6 +11265,311 @@ void    ImGui::TableSettingsInstallHandler(ImGuiContext* context)
     g.SettingsHandlers.push_back(ini_handler);
 }
 
+//-------------------------------------------------------------------------
+// TABLE - ImGuiTableData
+//-------------------------------------------------------------------------
+// - TableDataGetCellText() [Internal]
+// - TableDataRadixSort() [Internal]
+// - TableDataSortByValue() [Internal]
+// - TableDataMergeSortByText() [Internal]
+// - TableDataSortTextRange() [Internal]
+// - TableDataSortByText() [Internal]
+// - TableDataRebuild() [Internal]
+// - ImGuiTableData::Begin()
+// - ImGuiTableData::Step()
+// - ImGuiTableData::End()
+// - ImGuiTableData::RowText()
+//-------------------------------------------------------------------------
+
+ImGuiTableData::ImGuiTableData()
+{
+    DisplayStart = DisplayEnd = 0;
+    Filter = NULL;
+    PassFilter = NULL;
+    Columns = NULL;
+    ColumnsCount = 0;
+    RowsCount = -1;
+    UserData = NULL;
+    Dirty = true;
+}
+
+static const char* TableDataGetCellText(const ImGuiTableDataColumn* column, int column_n, void* user_data, int row, char* buf, int buf_size)
+{
+    if (column->GetText)
+        return column->GetText(user_data, row, column_n, buf, buf_size);
+    if (column->GetValue)
+        ImFormatString(buf, (size_t)buf_size, "%g", column->GetValue(user_data, row, column_n));
+    else
+        buf[0] = 0;
+    return buf;
+}
+
+// Stable LSD radix sort of RowsOrder[first..last) on SortKeys[first..last), 8 bits at a time.
+// Passes where all keys share the same byte are skipped, which is most of them for typical data (small integers, values of a similar magnitude).
+static void TableDataRadixSort(ImGuiTableData* data, int first, int last)
+{
+    const int count = last - first;
+    data->SortKeysTemp.resize(data->RowsOrder.Size);
+    data->SortRowsTemp.resize(data->RowsOrder.Size);
+    int* rows = data->RowsOrder.Data + first;
+    int* rows_tmp = data->SortRowsTemp.Data + first;
+    ImU64* keys = data->SortKeys.Data + first;
+    ImU64* keys_tmp = data->SortKeysTemp.Data + first;
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        int offsets[256] = {};
+        for (int n = 0; n < count; n++)
+            offsets[(keys[n] >> shift) & 0xFF]++;
+        if (offsets[(keys[0] >> shift) & 0xFF] == count)
+            continue;
+        for (int bucket = 0, sum = 0; bucket < 256; bucket++)
+        {
+            const int bucket_count = offsets[bucket];
+            offsets[bucket] = sum;
+            sum += bucket_count;
+        }
+        for (int n = 0; n < count; n++)
+        {
+            const int dst = offsets[(keys[n] >> shift) & 0xFF]++;
+            keys_tmp[dst] = keys[n];
+            rows_tmp[dst] = rows[n];
+        }
+        ImSwap(keys, keys_tmp);
+        ImSwap(rows, rows_tmp);
+    }
+    if (rows != data->RowsOrder.Data + first)
+        memcpy(data->RowsOrder.Data + first, rows, (size_t)count * sizeof(int));
+    if (keys != data->SortKeys.Data + first)
+        memcpy(data->SortKeys.Data + first, keys, (size_t)count * sizeof(ImU64));
+}
+
+static void TableDataSortByValue(ImGuiTableData* data, int column_n, bool descending)
+{
+    const ImGuiTableDataColumn* column = &data->Columns[column_n];
+    const int count = data->RowsOrder.Size;
+    if (count < 2)
+        return;
+
+    // Map doubles to unsigned integers of the same order: set the sign bit of positive values, flip all bits of negative values
+    data->SortKeys.resize(count);
+    for (int n = 0; n < count; n++)
+    {
+        const double value = column->GetValue(data->UserData, data->RowsOrder[n], column_n);
+        ImU64 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bits = (bits & ((ImU64)1 << 63)) ? ~bits : (bits | ((ImU64)1 << 63));
+        data->SortKeys[n] = descending ? ~bits : bits;
+    }
+    TableDataRadixSort(data, 0, count);
+}
+
+// Text of a row fetched by TableDataSortByText()
+static inline const char* TableDataGetSortText(const ImGuiTableData* data, int row)
+{
+    return data->SortTexts.Data + data->SortTextsOffsets.Data[row];
+}
+
+// Stable bottom-up merge sort of RowsOrder[first..last) on the texts fetched by TableDataSortByText()
+static void TableDataMergeSortByText(ImGuiTableData* data, int first, int last, bool descending)
+{
+    int* src = data->RowsOrder.Data;
+    int* dst = data->SortRowsTemp.Data;
+    for (int width = 1; width < last - first; width *= 2)
+    {
+        for (int lo = first; lo < last; lo += width * 2)
+        {
+            const int mid = ImMin(lo + width, last);
+            const int hi = ImMin(lo + width * 2, last);
+            int a = lo, b = mid, out = lo;
+            while (a < mid && b < hi)
+            {
+                const int cmp = strcmp(TableDataGetSortText(data, src[a]), TableDataGetSortText(data, src[b]));
+                dst[out++] = ((descending ? -cmp : cmp) <= 0) ? src[a++] : src[b++];
+            }
+            while (a < mid)
+                dst[out++] = src[a++];
+            while (b < hi)
+                dst[out++] = src[b++];
+        }
+        ImSwap(src, dst);
+    }
+    if (src != data->RowsOrder.Data)
+        memcpy(data->RowsOrder.Data + first, src + first, (size_t)(last - first) * sizeof(int));
+}
+
+// Stable sort of RowsOrder[first..last) on the texts fetched by TableDataSortByText(), which are known to be equal up to 'text_offset'.
+// Rows are radix sorted on the next 8 bytes of their text. Runs of rows sharing those 8 bytes are sorted again on the following ones.
+static void TableDataSortTextRange(ImGuiTableData* data, int first, int last, int text_offset, bool descending)
+{
+    if (last - first <= 16)
+    {
+        TableDataMergeSortByText(data, first, last, descending);
+        return;
+    }
+    for (int n = first; n < last; n++)
+    {
+        // Big-endian, so keys compare like strcmp() on these 8 bytes (texts ending before are padded with zeros)
+        const char* text = TableDataGetSortText(data, data->RowsOrder[n]) + text_offset;
+        ImU64 key = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            key <<= 8;
+            if (*text != 0)
+                key |= (unsigned char)*text++;
+        }
+        data->SortKeys[n] = descending ? ~key : key;
+    }
+    TableDataRadixSort(data, first, last);
+    for (int run_first = first; run_first < last; )
+    {
+        int run_last = run_first + 1;
+        while (run_last < last && data->SortKeys[run_last] == data->SortKeys[run_first])
+            run_last++;
+        // Texts of the run continue past these 8 bytes unless the key is zero padded (then they all end within them, and are equal)
+        const ImU64 key = descending ? ~data->SortKeys[run_first] : data->SortKeys[run_first];
+        if (run_last - run_first > 1 && (key & 0xFF) != 0)
+            TableDataSortTextRange(data, run_first, run_last, text_offset + 8, descending);
+        run_first = run_last;
+    }
+}
+
+// Stable sort of RowsOrder[] on the text of a column. Each text is fetched once.
+static void TableDataSortByText(ImGuiTableData* data, int column_n, bool descending)
+{
+    const ImGuiTableDataColumn* column = &data->Columns[column_n];
+    const int count = data->RowsOrder.Size;
+    if (count < 2)
+        return;
+
+    data->SortTexts.resize(0);
+    data->SortTextsOffsets.resize(data->RowsCount);
+    for (int n = 0; n < count; n++)
+    {
+        const int row = data->RowsOrder[n];
+        char buf[256];
+        const char* text = TableDataGetCellText(column, column_n, data->UserData, row, buf, IM_ARRAYSIZE(buf));
+        const int text_size = (int)strlen(text) + 1;
+        data->SortTextsOffsets[row] = data->SortTexts.Size;
+        data->SortTexts.resize(data->SortTexts.Size + text_size);
+        memcpy(data->SortTexts.Data + data->SortTextsOffsets[row], text, (size_t)text_size);
+    }
+    data->SortKeys.resize(count);
+    data->SortRowsTemp.resize(count);
+    TableDataSortTextRange(data, 0, count, 0, descending);
+}
+
+static void TableDataRebuild(ImGuiTableData* data, const ImGuiTableSortSpecs* sort_specs)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Tables);
+
+    // Filter
+    const bool use_text_filter = (data->Filter != NULL && data->Filter->IsActive());
+    data->RowsOrder.resize(0);
+    data->RowsOrder.reserve(data->RowsCount);
+    for (int row = 0; row < data->RowsCount; row++)
+    {
+        if (data->PassFilter && !data->PassFilter(data->UserData, row))
+            continue;
+        if (use_text_filter)
+        {
+            // Join the text of all columns, so exclusions ("-xxx") apply to the whole row
+            char line[1024];
+            char* line_end = line;
+            for (int column_n = 0; column_n < data->ColumnsCount; column_n++)
+            {
+                const ImGuiTableDataColumn* column = &data->Columns[column_n];
+                if (column->GetText == NULL)
+                    continue;
+                char buf[256];
+                const char* text = column->GetText(data->UserData, row, column_n, buf, IM_ARRAYSIZE(buf));
+                if (line_end != line && line_end < line + IM_ARRAYSIZE(line) - 1)
+                    *line_end++ = '\t';
+                line_end += ImFormatString(line_end, (size_t)(line + IM_ARRAYSIZE(line) - line_end), "%s", text);
+            }
+            if (!data->Filter->PassFilter(line, line_end))
+                continue;
+        }
+        data->RowsOrder.push_back(row);
+    }
+
+    // Sort, one stable pass per sort spec from the least significant to the most significant
+    if (sort_specs == NULL)
+        return;
+    for (int spec_n = sort_specs->SpecsCount - 1; spec_n >= 0; spec_n--)
+    {
+        const ImGuiTableSortSpecsColumn* spec = &sort_specs->Specs[spec_n];
+        IM_ASSERT(spec->ColumnUserID < (ImGuiID)data->ColumnsCount);
+        const int column_n = (int)spec->ColumnUserID;
+        const bool descending = (spec->SortDirection == ImGuiSortDirection_Descending);
+        if (data->Columns[column_n].GetValue)
+            TableDataSortByValue(data, column_n, descending);
+        else if (data->Columns[column_n].GetText)
+            TableDataSortByText(data, column_n, descending);
+    }
+}
+
+bool ImGuiTableData::Begin(const char* str_id, const ImGuiTableDataColumn* columns, int columns_count, int rows_count, void* user_data, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
+{
+    if (!ImGui::BeginTable(str_id, columns_count, flags, outer_size, inner_width))
+        return false;
+
+    if (Columns != columns || ColumnsCount != columns_count || RowsCount != rows_count || UserData != user_data)
+        Dirty = true;
+    Columns = columns;
+    ColumnsCount = columns_count;
+    RowsCount = rows_count;
+    UserData = user_data;
+
+    for (int column_n = 0; column_n < columns_count; column_n++)
+        ImGui::TableSetupColumn(columns[column_n].Label, columns[column_n].Flags, (columns[column_n].InitWidthOrWeight != 0.0f) ? columns[column_n].InitWidthOrWeight : -1.0f, (ImU32)column_n);
+    if (flags & ImGuiTableFlags_ScrollY)
+        ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableHeadersRow();
+
+    ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs();
+    if (sort_specs && sort_specs->SpecsDirty)
+    {
+        sort_specs->SpecsDirty = false;
+        Dirty = true;
+    }
+    if (Dirty)
+    {
+        TableDataRebuild(this, sort_specs);
+        Dirty = false;
+    }
+
+    Clipper.Begin(RowsOrder.Size);
+    DisplayStart = DisplayEnd = 0;
+    return true;
+}
+
+bool ImGuiTableData::Step()
+{
+    if (!Clipper.Step())
+        return false;
+    DisplayStart = Clipper.DisplayStart;
+    DisplayEnd = Clipper.DisplayEnd;
+    return true;
+}
+
+void ImGuiTableData::End()
+{
+    Clipper.End();
+    ImGui::EndTable();
+}
+
+void ImGuiTableData::RowText(int row)
+{
+    ImGui::TableNextRow();
+    for (int column_n = 0; column_n < ColumnsCount; column_n++)
+    {
+        if (!ImGui::TableNextColumn())
+            continue;
+        char buf[256];
+        ImGui::TextUnformatted(TableDataGetCellText(&Columns[column_n], column_n, UserData, row, buf, IM_ARRAYSIZE(buf)));
+    }
+}
+
 //-------------------------------------------------------------------------
 
 #endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,11 @@
+// Dear ImGui options of this app, included by imgui.h before imconfig.h (the Makefile passes -DIMGUI_USER_CONFIG).
+
+// Use a thread-local current context, so draw_gui() can record windows on worker threads (see ImGui::CreateWorkerContext()).
+// MyImGuiTLS is defined in main.cpp.
+struct ImGuiContext;
+extern thread_local ImGuiContext* MyImGuiTLS;
+#define GImGui MyImGuiTLS
+
+// Formats not handled by the fast path of ImFormatStringV() go to vsnprintf(). stb_sprintf.h is not part of this tree: copy it to src/
+// and uncomment to use stbsp_vsnprintf() instead (the format checks of GCC and clang are then disabled, see imconfig.h).
+//#define IMGUI_USE_STB_SPRINTF
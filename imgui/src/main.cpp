@@ -1,8 +1,17 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"  // ImHashStr
 #include "imgui/imgui_impl_glfw.h"
 #include "imgui/imgui_impl_opengl3.h"
+#include "imgui/imgui_impl_softraster.h"
+#include "scores.h"
 
 #include <GL/gl3w.h>  // Initialize with gl3wInit()
 #include <GLFW/glfw3.h> // Include glfw3.h after our OpenGL definitions
@@ -14,6 +23,13 @@
 #define WIDTH  1280
 #define HEIGHT 650
 
+// Bump whenever the data displayed in the "scores" window changes.
+// Widget interaction doesn't need it: a hovered or active window is always rebuilt.
+static ImU32 scores_version = 0;
+
+// Current context of each thread, see imgui_user_config.h
+thread_local ImGuiContext* MyImGuiTLS = NULL;
+
 // Win32 exceptions
 #if defined(_MSC_VER) && (_MSC_VER >= 1900) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
 #pragma comment(lib, "legacy_stdio_definitions")
@@ -24,6 +40,41 @@ static void glfw_error_callback(int error, const char* description)
   fprintf(stderr, "Glfw Error %d: %s\n", error, description);
 }
 
+/* Set when the window system lost the window contents (e.g. it was uncovered), so the next frame is presented even if unchanged */
+static bool present_needed = true;
+
+static void glfw_refresh_callback(GLFWwindow* window)
+{
+  (void)window;
+  present_needed = true;
+}
+
+/* What a presented frame was made of. A frame is only skipped when all of it matches the one on screen:
+   the 32-bit content hash alone could collide and freeze stale content */
+struct frame_signature {
+  ImU32 hash;
+  int   vtx_count, idx_count, cmd_count;
+  int   display_w, display_h;
+};
+
+static frame_signature get_frame_signature(ImDrawData* draw_data, int display_w, int display_h) {
+  frame_signature sig;
+  sig.hash = draw_data->GetContentHash();
+  sig.vtx_count = draw_data->TotalVtxCount;
+  sig.idx_count = draw_data->TotalIdxCount;
+  sig.cmd_count = 0;
+  for (int i = 0; i < draw_data->CmdListsCount; i++)
+    sig.cmd_count += draw_data->CmdLists[i]->CmdBuffer.Size;
+  sig.display_w = display_w;
+  sig.display_h = display_h;
+  return sig;
+}
+
+static bool same_frame_signature(const frame_signature& a, const frame_signature& b) {
+  return a.hash == b.hash && a.vtx_count == b.vtx_count && a.idx_count == b.idx_count && a.cmd_count == b.cmd_count &&
+         a.display_w == b.display_w && a.display_h == b.display_h;
+}
+
 static void Tooltip(const char* desc) {
   if (ImGui::IsItemHovered()) {
     ImGui::BeginTooltip();
@@ -49,7 +100,7 @@ static void RangeInt(int* counter, int padding, int limitinf, int limitsup, cons
   ImGui::PopButtonRepeat();
 }
 
-static void create_window(const char* window_name, int window_x, int window_y, int window_w, int window_h) {
+static bool create_window(const char* window_name, int window_x, int window_y, int window_w, int window_h) {
   ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoTitleBar |
                                   ImGuiWindowFlags_NoScrollbar |
                                   ImGuiWindowFlags_NoMove |
@@ -58,7 +109,7 @@ static void create_window(const char* window_name, int window_x, int window_y, i
                                   ImGuiWindowFlags_AlwaysUseWindowPadding;
   ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_FirstUseEver);
   ImGui::SetNextWindowSize(ImVec2(window_w, window_h), ImGuiCond_FirstUseEver);
-  ImGui::Begin(window_name, NULL, window_flags);
+  return ImGui::Begin(window_name, NULL, window_flags);
 }
 
 static void make_table(const char* name, int rows, int cols, const char** row_headers, const char** col_headers) {
@@ -101,99 +152,212 @@ static void make_leaderboard(const char* name, const char** headers) {
   }
 }
 
-int main(int, char**)
-{
-  // Setup window
-  glfwSetErrorCallback(glfw_error_callback);
-  if (!glfwInit())
-  return 1;
+/* Highscores snapshot, stored by column so the histograms bin it with SIMD (see scores.h).
+   Placeholder contents until scores are loaded */
+struct scores_snapshot {
+  ImVector<float> scores;  // One entry per highscore: board * board_ranks + rank
+  ImVector<ImU8>  ranks;
+  ImVector<ImU8>  types;   // BOARD_LEVEL, BOARD_EPISODE or BOARD_STORY
+  ImU32           version; // Bumped on every load, invalidates the histograms
+};
+
+static scores_snapshot snapshot = { ImVector<float>(), ImVector<ImU8>(), ImVector<ImU8>(), 0 };
+
+static void load_placeholder_scores() {
+  unsigned int seed = 12345;
+  snapshot.scores.resize(boards_count * board_ranks);
+  snapshot.ranks.resize(boards_count * board_ranks);
+  snapshot.types.resize(boards_count * board_ranks);
+  for (int board = 0; board < boards_count; board++) {
+    ImU8 type = board < type_first_board[1] ? BOARD_LEVEL : board < type_first_board[2] ? BOARD_EPISODE : BOARD_STORY;
+    seed = seed * 1664525u + 1013904223u;
+    float score = (type == BOARD_LEVEL ? 100.0f : type == BOARD_EPISODE ? 400.0f : 1500.0f) + (seed >> 8) % 40000 * (type == BOARD_STORY ? 0.05f : 0.01f);
+    for (int rank = 0; rank < board_ranks; rank++) {
+      int i = board * board_ranks + rank;
+      seed = seed * 1664525u + 1013904223u;
+      snapshot.scores[i] = score;
+      snapshot.ranks[i] = (ImU8)rank;
+      snapshot.types[i] = type;
+      score -= (seed >> 8) % 500 * 0.001f * (rank + 1);
+    }
+  }
+  snapshot.version++;
+}
 
-  // Decide GL+GLSL versions
-  #ifdef __APPLE__
-  // GL 3.2 + GLSL 150
-  const char* glsl_version = "#version 150";
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
-  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
-  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // Required on Mac
-  #else
-  // GL 3.0 + GLSL 130
-  const char* glsl_version = "#version 130";
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-  //glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
-  //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // 3.0+ only
-  #endif
-  glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
-  //glfwWindowHint(GLFW_DECORATED, GL_FALSE);
+/* Distribution plotted under the personal stats, rebuilt only when the snapshot or the selected tabs change */
+enum { HISTOGRAM_SCORES, HISTOGRAM_RANKS };
+
+struct scores_histogram {
+  ImU32            snapshot_version;
+  ImU8             types_mask;
+  int              kind;
+  bool             valid;
+  ImVector<float>  bins;
+  ImGuiPlotPyramid pyramid;
+  float            v_min, v_max; // Range of the scores, for HISTOGRAM_SCORES
+};
+
+static void update_histogram(scores_histogram* h, ImU8 types_mask, int kind) {
+  if (h->valid && h->snapshot_version == snapshot.version && h->types_mask == types_mask && h->kind == kind)
+    return;
+  h->valid = true;
+  h->snapshot_version = snapshot.version;
+  h->types_mask = types_mask;
+  h->kind = kind;
+  h->bins.resize(kind == HISTOGRAM_RANKS ? board_ranks : score_bins_count);
+  memset(h->bins.Data, 0, (size_t)h->bins.size_in_bytes());
+  h->v_min = h->v_max = 0.0f;
+  const int count = snapshot.scores.Size;
+  if (kind == HISTOGRAM_RANKS)
+    count_ranks(snapshot.ranks.Data, snapshot.types.Data, count, types_mask, h->bins.Data);
+  else if (scores_range(snapshot.scores.Data, snapshot.types.Data, count, types_mask, &h->v_min, &h->v_max))
+    bin_scores(snapshot.scores.Data, snapshot.types.Data, count, types_mask, h->v_min, h->v_max, h->bins.Size, h->bins.Data);
+  h->pyramid.Build(h->bins.Data, h->bins.Size);
+}
 
-  // Create window with graphics context
-  GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, NAME, NULL, NULL);
-  if (window == NULL)
-  return 1;
-  glfwMakeContextCurrent(window);
-  glfwSwapInterval(1); // Enable vsync
+/* Board x rank heatmap of the snapshot: one texel per highscore, coloured by its score delta to the 0th.
+   Boards are laid out in bands of heatmap_band_boards columns by board_ranks rows, and shown with one ImGui::Image per band
+   instead of thousands of rects. Cells are recoloured while recording the frame, and only the rectangle of the changed ones
+   is uploaded to the OpenGL texture afterwards (the software rasterizer reads the pixels directly) */
+static const int heatmap_band_boards = 600;
+static const int heatmap_width = heatmap_band_boards;
+static const int heatmap_height = (boards_count + heatmap_band_boards - 1) / heatmap_band_boards * board_ranks;
+
+struct scores_heatmap {
+  ImVector<ImU32>              pixels;           // heatmap_width x heatmap_height, IM_COL32
+  ImU32                        snapshot_version;
+  int                          dirty_x0, dirty_y0, dirty_x1, dirty_y1; // Changed texels not uploaded yet, none when dirty_x0 >= dirty_x1
+  GLuint                       gl_texture;
+  ImGui_ImplSoftRaster_Texture soft_texture;
+};
+
+static scores_heatmap heatmap = { ImVector<ImU32>(), 0, heatmap_width, heatmap_height, 0, 0, 0, { NULL, 0, 0 } };
+static bool headless = false;
+
+static ImU32 heatmap_color(float t) {
+  const ImVec4 best(1.0f, 0.86f, 0.16f, 1.0f);
+  const ImVec4 worst(0.12f, 0.16f, 0.47f, 1.0f);
+  return ImGui::ColorConvertFloat4ToU32(ImVec4(best.x + (worst.x - best.x) * t, best.y + (worst.y - best.y) * t, best.z + (worst.z - best.z) * t, 1.0f));
+}
 
-  // Initialize OpenGL loader
-  if (gl3wInit() != 0)
-  {
-    fprintf(stderr, "Failed to initialize OpenGL loader!\n");
-    return 1;
+static void update_heatmap() {
+  if (heatmap.snapshot_version == snapshot.version)
+    return;
+  heatmap.snapshot_version = snapshot.version;
+  if (heatmap.pixels.Size != heatmap_width * heatmap_height) {
+    heatmap.pixels.resize(heatmap_width * heatmap_height);
+    memset(heatmap.pixels.Data, 0, (size_t)heatmap.pixels.size_in_bytes());
+    heatmap.soft_texture.Pixels = heatmap.pixels.Data;
+    heatmap.soft_texture.Width = heatmap_width;
+    heatmap.soft_texture.Height = heatmap_height;
   }
+  const int boards = snapshot.scores.Size / board_ranks;
+  for (int board = 0; board < boards && board < boards_count; board++) {
+    const float* scores = snapshot.scores.Data + board * board_ranks;
+    const float range = scores[0] - scores[board_ranks - 1];
+    const int x = board % heatmap_band_boards;
+    const int y0 = board / heatmap_band_boards * board_ranks;
+    for (int rank = 0; rank < board_ranks; rank++) {
+      const ImU32 col = heatmap_color(range > 0.0f ? (scores[0] - scores[rank]) / range : 0.0f);
+      ImU32* pixel = &heatmap.pixels[(y0 + rank) * heatmap_width + x];
+      if (*pixel == col)
+        continue;
+      *pixel = col;
+      if (x < heatmap.dirty_x0) heatmap.dirty_x0 = x;
+      if (x + 1 > heatmap.dirty_x1) heatmap.dirty_x1 = x + 1;
+      if (y0 + rank < heatmap.dirty_y0) heatmap.dirty_y0 = y0 + rank;
+      if (y0 + rank + 1 > heatmap.dirty_y1) heatmap.dirty_y1 = y0 + rank + 1;
+    }
+  }
+}
 
-  // Setup Dear ImGui context
-  IMGUI_CHECKVERSION();
-  ImGui::CreateContext();
-  ImGuiIO& io = ImGui::GetIO(); (void)io;
-  //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
-  //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
-
-  // Setup Dear ImGui style
-  ImGui::StyleColorsDark();
+/* Main thread only, with the OpenGL context current */
+static void create_heatmap_texture() {
+  GLint last_texture;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+  glGenTextures(1, &heatmap.gl_texture);
+  glBindTexture(GL_TEXTURE_2D, heatmap.gl_texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, heatmap_width, heatmap_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+  glBindTexture(GL_TEXTURE_2D, last_texture);
+}
 
-  // Setup Platform/Renderer bindings
-  ImGui_ImplGlfw_InitForOpenGL(window, true);
-  ImGui_ImplOpenGL3_Init(glsl_version);
+static void destroy_heatmap_texture() {
+  glDeleteTextures(1, &heatmap.gl_texture);
+  heatmap.gl_texture = 0;
+}
 
-  // Don't create ini config file
-  io.IniFilename = NULL;
+/* Returns true when texels changed, the draw data alone doesn't show it */
+static bool upload_heatmap() {
+  if (heatmap.dirty_x0 >= heatmap.dirty_x1)
+    return false;
+  GLint last_texture;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+  glBindTexture(GL_TEXTURE_2D, heatmap.gl_texture);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, heatmap_width);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, heatmap.dirty_x0, heatmap.dirty_y0, heatmap.dirty_x1 - heatmap.dirty_x0, heatmap.dirty_y1 - heatmap.dirty_y0,
+                  GL_RGBA, GL_UNSIGNED_BYTE, heatmap.pixels.Data + heatmap.dirty_y0 * heatmap_width + heatmap.dirty_x0);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  glBindTexture(GL_TEXTURE_2D, last_texture);
+  heatmap.dirty_x0 = heatmap_width;
+  heatmap.dirty_y0 = heatmap_height;
+  heatmap.dirty_x1 = heatmap.dirty_y1 = 0;
+  return true;
+}
 
-  // Background
-  ImVec4 clear_color = ImVec4(0.0586f, 0.0586f, 0.0586f, 0.9375f);
+/* The boards of one type, one band per row of images. Hovered cells are found from the mouse position */
+static void draw_heatmap(int type) {
+  update_heatmap();
+  ImTextureID texture_id = headless ? (ImTextureID)&heatmap.soft_texture : (ImTextureID)(intptr_t)heatmap.gl_texture;
+  const float band_w = ImGui::GetContentRegionAvail().x;
+  const float rank_h = 3.0f;
+  const int first = type_first_board[type];
+  const int last = first + type_boards_count[type];
+  for (int band_first = first; band_first < last; ) {
+    const int band = band_first / heatmap_band_boards;
+    const int band_last = (last < (band + 1) * heatmap_band_boards) ? last : (band + 1) * heatmap_band_boards;
+    const int x0 = band_first % heatmap_band_boards;
+    const int x1 = x0 + (band_last - band_first);
+    const ImVec2 size(band_w * (x1 - x0) / heatmap_band_boards, rank_h * board_ranks);
+    const ImVec2 uv0((float)x0 / heatmap_width, (float)(band * board_ranks) / heatmap_height);
+    const ImVec2 uv1((float)x1 / heatmap_width, (float)((band + 1) * board_ranks) / heatmap_height);
+    ImGui::Image(texture_id, size, uv0, uv1);
+    if (ImGui::IsItemHovered()) {
+      const ImVec2 mouse = ImGui::GetIO().MousePos;
+      const ImVec2 min = ImGui::GetItemRectMin();
+      int board = band_first + (int)((mouse.x - min.x) / size.x * (x1 - x0));
+      int rank = (int)((mouse.y - min.y) / rank_h);
+      if (board >= band_last) board = band_last - 1;
+      if (rank >= board_ranks) rank = board_ranks - 1;
+      if (board >= 0 && rank >= 0 && (board + 1) * board_ranks <= snapshot.scores.Size) {
+        const float* scores = snapshot.scores.Data + board * board_ranks;
+        ImGui::SetTooltip("Board %d, rank %d: %.3f (%.3f behind the 0th)", board - first, rank, scores[rank], scores[0] - scores[rank]);
+      }
+    }
+    band_first = band_last;
+  }
+}
 
-  // Main loop
-  while (!glfwWindowShouldClose(window))
-  {
-    // Poll and handle events (inputs, window resize, etc.)
-    // You can read the io.WantCaptureMouse, io.WantCaptureKeyboard flags to tell if dear imgui wants to use your inputs.
-    // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
-    // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
-    // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-    glfwPollEvents();
+/* Fixed layout: "scores" and "savefile" side by side, "footer" below them */
+static int top_windows_height() {
+  return ImGui::GetTextLineHeightWithSpacing() * 36.5;
+}
 
-    // Start the Dear ImGui frame
-    ImGui_ImplOpenGL3_NewFrame();
-    ImGui_ImplGlfw_NewFrame();
-    ImGui::NewFrame();
+static void draw_scores() {
+  int win1_x = 0;
+  int win1_y = 0;
+  int win1_w = 640;
+  int win1_h = top_windows_height();
 
-    const char* s_tabs[6]   = { "SI", "S", "SU", "SL", "?", "!" };
-    const char* s_types[3]  = { "Levels", "Episodes", "Stories" };
-    const char* s_modes[4]  = { "Solo", "Coop", "Race", "Hardcore" };
-    int win1_x = 0;
-    int win1_y = 0;
-    int win1_w = 640;
-    int win1_h = ImGui::GetTextLineHeightWithSpacing() * 36.5;
-    int win2_x = win1_x + win1_w;
-    int win2_y = 0;
-    int win2_w = 640;
-    int win2_h = ImGui::GetTextLineHeightWithSpacing() * 36.5;
-    int win3_x = 0;
-    int win3_y = win1_x + win1_h;
-    int win3_w = WIDTH;
-    int win3_h = HEIGHT - win1_h;
+  if (snapshot.version == 0) {
+    load_placeholder_scores();
+    scores_version++;
+  }
 
-    {
-      create_window("scores", win1_x, win1_y, win1_w, win1_h);
+  {
+    ImGui::SetNextWindowContentVersion(scores_version);
+    if (create_window("scores", win1_x, win1_y, win1_w, win1_h)) {
       ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "HIGHSCORE ANALYSIS"); ImGui::SameLine();
       ImGui::Text("Loaded:"); ImGui::SameLine();
       ImGui::Text("None"); ImGui::SameLine(ImGui::GetWindowWidth() - 30);
@@ -219,24 +383,30 @@ int main(int, char**)
         ImGui::Text("          PERSONAL HIGHSCORING STATS");
         const char* row_headers[7] = { "SI", "S", "SU", "SL", "?", "!", "Total" };
         const char* col_headers[5] = { "Tabs", "Top20", "Top10", "Top5", "0th" };
+        static ImU8 stats_types = BOARD_LEVEL | BOARD_EPISODE;
+        static int histogram_kind = HISTOGRAM_SCORES;
         ImGuiTabBarFlags tab_flags = ImGuiTabBarFlags_None;
         if (ImGui::BeginTabBar("stat_tabs", tab_flags)) {
           ImGui::TabItemButton("?", ImGuiTabItemFlags_Leading | ImGuiTabItemFlags_NoTooltip);
           Tooltip("Solo includes both levels and episodes from solo mode, that \
                    is, the standard highscoring metric used in the community.");
           if (ImGui::BeginTabItem("Solo")) {
+            stats_types = BOARD_LEVEL | BOARD_EPISODE;
             make_table("solo", 8, 5, row_headers, col_headers);
             ImGui::EndTabItem();
           }
           if (ImGui::BeginTabItem("Levels")) {
+            stats_types = BOARD_LEVEL;
             make_table("levels", 8, 5, row_headers, col_headers);
             ImGui::EndTabItem();
           }
           if (ImGui::BeginTabItem("Episodes")) {
+            stats_types = BOARD_EPISODE;
             make_table("episodes", 8, 5, row_headers, col_headers);
             ImGui::EndTabItem();
           }
           if (ImGui::BeginTabItem("Stories")) {
+            stats_types = BOARD_STORY;
             make_table("stories", 8, 5, row_headers, col_headers);
             ImGui::EndTabItem();
           }
@@ -250,23 +420,26 @@ int main(int, char**)
                    awards points for each highscore you have: 20 points for a 0th, \
                    19 for 1st... up to 1 for 19th.");
           if (ImGui::BeginTabItem("Total score")) {
+            histogram_kind = HISTOGRAM_SCORES;
             make_table("total_score", 8, 5, row_headers, col_headers2);
             ImGui::EndTabItem();
           }
           if (ImGui::BeginTabItem("Points")) {
+            histogram_kind = HISTOGRAM_RANKS;
             make_table("points", 8, 5, row_headers, col_headers2);
             ImGui::EndTabItem();
           }
           ImGui::EndTabBar();
         }
 
-        static float arr[] = {
-           0.0f,   1.0f,  5.0f, 12.0f, 17.0f,
-          35.0f,  56.0f, 43.0f, 43.0f, 30.0f,
-          25.0f,  28.0f, 37.0f, 68.0f, 78.0f,
-          89.0f, 100.0f, 90.0f, 80.0f, 85.0f
-        };
-        ImGui::PlotHistogram("", arr, IM_ARRAYSIZE(arr), 0, NULL, 0, 100, ImVec2(ImGui::GetContentRegionAvail().x * 1.0f, 200));
+        static scores_histogram histogram;
+        update_histogram(&histogram, stats_types, histogram_kind);
+        char overlay[64];
+        if (histogram_kind == HISTOGRAM_RANKS)
+          sprintf(overlay, "Highscores by rank (0th to 19th)");
+        else
+          sprintf(overlay, "Highscores by score (%.0f to %.0f)", histogram.v_min, histogram.v_max);
+        ImGui::PlotHistogram("", histogram.pyramid, overlay, 0, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x * 1.0f, 200));
 
         ImGui::TableNextColumn();
 
@@ -508,139 +681,398 @@ int main(int, char**)
             make_leaderboard("lists", col_headers4);
             ImGui::EndTabItem();
           }
+          if (ImGui::BeginTabItem("Heatmap")) {
+            static int heatmap_type = 0;
+            ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 0));
+            ImGui::Text("Type"); ImGui::SameLine();
+            ImGui::RadioButton("Level",   &heatmap_type, 0); ImGui::SameLine();
+            ImGui::RadioButton("Episode", &heatmap_type, 1); ImGui::SameLine();
+            ImGui::RadioButton("Story",   &heatmap_type, 2);
+            ImGui::PopStyleVar();
+            ImGui::Text("Boards x ranks, by delta to the 0th");
+            draw_heatmap(heatmap_type);
+            ImGui::EndTabItem();
+          }
           ImGui::EndTabBar();
         }
         ImGui::EndTable();
       }
-
-      ImGui::End();
     }
+    ImGui::End();
+  }
+}
 
-    {
-      /* Data */
-      static bool tabs[6]     = { true, true, true, true, true, true };
-      static bool states[3]   = { true, true, true };
-      static bool types[3]    = { true, false, false };
-      static bool modes[4]    = { true, false, false, false };
-      static bool orders[7]   = { true, false, false, false, false, false, false };
-      static bool rev_order   = false;
-      const char* titles[4]   = { "Tabs", "Types", "Modes", "States" };
-      const char* s_states[3] = { "Locked", "Unlocked", "Completed" };
-      const char* headers[7]  = { "ID", "State", "Atts.", "Vics.", "Gold", "Score", "Rank" };
-      int table_lines         = 25;
-
-      /* Header */
-      create_window("savefile", win2_x, win2_y, win2_w, win2_h);
-      ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "SAVEFILE ANALYSIS"); ImGui::SameLine();
-      ImGui::Text("Loaded:"); ImGui::SameLine();
-      ImGui::Text("None"); ImGui::SameLine(ImGui::GetWindowWidth() - 30);
-      HelpMarker("This section will analyze your savefile and provide stats. \
-                  You first need to load it by clicking on 'Open savefile'. \
-                  If you don't know where the savefile is located, click on the 'Help' menu.");
-      ImGui::SmallButton("Open savefile");
+/* Blocks table: placeholder contents until a savefile is loaded */
+static const int blocks_count = 2000;
 
-      /* Checkboxes */
-      ImGui::Columns(4);
-      ImGui::Separator();
-      for (int i = 0; i < 4; i++) {
-        ImGui::Text("%s", titles[i]); ImGui::NextColumn();
-      }
-      ImGui::Separator();
-      ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(2, 0));
-      ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 0));
-      for (int i = 0; i < 6; i++) {
-                   ImGui::Checkbox(s_tabs[i],   &tabs[i]);   ImGui::NextColumn();
-        if (i < 3) ImGui::Checkbox(s_types[i],  &types[i]);  ImGui::NextColumn();
-        if (i < 4) ImGui::Checkbox(s_modes[i],  &modes[i]);  ImGui::NextColumn();
-        if (i < 3) ImGui::Checkbox(s_states[i], &states[i]); ImGui::NextColumn();
-      }
-      ImGui::PopStyleVar(2);
-
-      /* Table */
-      ImGui::Columns(1);
-      static ImGuiTableFlags table_flags =
-            ImGuiTableFlags_Resizable | ImGuiTableFlags_MultiSortable
-            | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV
-            | ImGuiTableFlags_ScrollY;
-      if (ImGui::BeginTable("blocks", 7, table_flags, ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * table_lines), 0.0f)) {
-        /* Create columns */
-        ImGui::TableSetupColumn(headers[0], ImGuiTableColumnFlags_DefaultSort          | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn(headers[1], ImGuiTableColumnFlags_NoSort               | ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupColumn(headers[2], ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupColumn(headers[3], ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupColumn(headers[4], ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupColumn(headers[5], ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupColumn(headers[6],                                              ImGuiTableColumnFlags_WidthFixed,   -1.0f);
-        ImGui::TableSetupScrollFreeze(0, 1); // Header always visible after scrolling
-
-        /* Sort data */
-        if (ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs()) {
-          if (sorts_specs->SpecsDirty) { // Detect if sorting is required
-            // Sort here!
-            sorts_specs->SpecsDirty = false;
-          }
-        }
+static const char* block_text(void* user_data, int row, int column, char* buf, int buf_size) {
+  (void)user_data;
+  if (column == 0) return "SI-A-00-00";
+  snprintf(buf, buf_size, " (%d, %d)", row, column);
+  return buf;
+}
 
-        /* Display data */
-        ImGui::TableHeadersRow();
-        for (int i = 0; i < 2000; i++) {
-          ImGui::TableNextRow();
-          for (int j = 0; j < 7; j++) {
-            ImGui::TableNextColumn();
-            if (j == 0) {
-              ImGui::Text("SI-A-00-00");
-            } else {
-              ImGui::Text(" (%d, %d)", i, j);
-            }
-          }
+static double block_value(void* user_data, int row, int column) {
+  (void)user_data;
+  (void)column;
+  return row;
+}
+
+static void draw_savefile() {
+  const char* s_tabs[6]   = { "SI", "S", "SU", "SL", "?", "!" };
+  const char* s_types[3]  = { "Levels", "Episodes", "Stories" };
+  const char* s_modes[4]  = { "Solo", "Coop", "Race", "Hardcore" };
+  int win2_x = 640;
+  int win2_y = 0;
+  int win2_w = 640;
+  int win2_h = top_windows_height();
+
+  {
+    /* Data */
+    static bool tabs[6]     = { true, true, true, true, true, true };
+    static bool states[3]   = { true, true, true };
+    static bool types[3]    = { true, false, false };
+    static bool modes[4]    = { true, false, false, false };
+    static bool orders[7]   = { true, false, false, false, false, false, false };
+    static bool rev_order   = false;
+    const char* titles[4]   = { "Tabs", "Types", "Modes", "States" };
+    const char* s_states[3] = { "Locked", "Unlocked", "Completed" };
+    int table_lines         = 25;
+
+    /* Header */
+    create_window("savefile", win2_x, win2_y, win2_w, win2_h);
+    ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "SAVEFILE ANALYSIS"); ImGui::SameLine();
+    ImGui::Text("Loaded:"); ImGui::SameLine();
+    ImGui::Text("None"); ImGui::SameLine(ImGui::GetWindowWidth() - 30);
+    HelpMarker("This section will analyze your savefile and provide stats. \
+                You first need to load it by clicking on 'Open savefile'. \
+                If you don't know where the savefile is located, click on the 'Help' menu.");
+    ImGui::SmallButton("Open savefile");
+
+    /* Checkboxes */
+    ImGui::Columns(4);
+    ImGui::Separator();
+    for (int i = 0; i < 4; i++) {
+      ImGui::Text("%s", titles[i]); ImGui::NextColumn();
+    }
+    ImGui::Separator();
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(2, 0));
+    ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 0));
+    for (int i = 0; i < 6; i++) {
+                 ImGui::Checkbox(s_tabs[i],   &tabs[i]);   ImGui::NextColumn();
+      if (i < 3) ImGui::Checkbox(s_types[i],  &types[i]);  ImGui::NextColumn();
+      if (i < 4) ImGui::Checkbox(s_modes[i],  &modes[i]);  ImGui::NextColumn();
+      if (i < 3) ImGui::Checkbox(s_states[i], &states[i]); ImGui::NextColumn();
+    }
+    ImGui::PopStyleVar(2);
+
+    /* Table */
+    ImGui::Columns(1);
+    static ImGuiTableFlags table_flags =
+          ImGuiTableFlags_Resizable | ImGuiTableFlags_MultiSortable
+          | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV
+          | ImGuiTableFlags_ScrollY;
+    static const ImGuiTableDataColumn blocks_columns[7] = {
+      { "ID",    ImGuiTableColumnFlags_DefaultSort          | ImGuiTableColumnFlags_WidthStretch, -1.0f, NULL,        block_text },
+      { "State", ImGuiTableColumnFlags_NoSort               | ImGuiTableColumnFlags_WidthFixed,   -1.0f, NULL,        block_text },
+      { "Atts.", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f, block_value, block_text },
+      { "Vics.", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f, block_value, block_text },
+      { "Gold",  ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f, block_value, block_text },
+      { "Score", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed,   -1.0f, block_value, block_text },
+      { "Rank",                                               ImGuiTableColumnFlags_WidthFixed,   -1.0f, block_value, block_text },
+    };
+    static ImGuiTableData blocks;
+    if (blocks.Begin("blocks", blocks_columns, 7, blocks_count, NULL, table_flags, ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * table_lines), 0.0f)) {
+      /* Only the visible rows are submitted, in sorted order */
+      while (blocks.Step()) {
+        for (int i = blocks.DisplayStart; i < blocks.DisplayEnd; i++) {
+          blocks.RowText(blocks.RowsOrder[i]);
         }
-        ImGui::EndTable();
       }
+      blocks.End();
+    }
 
-      /* Table footer */
-      static ImGuiTableFlags footer_flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter;
-      if (ImGui::BeginTable("footer", 7, footer_flags, ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 2), 0.0f)) {
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
-        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+    /* Table footer */
+    static ImGuiTableFlags footer_flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter;
+    if (ImGui::BeginTable("footer", 7, footer_flags, ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 2), 0.0f)) {
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
+      ImGui::TableSetupColumn("", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, -1.0f);
 
-        ImGui::TableNextRow();
-        ImGui::TableNextColumn();
-        ImGui::Text("Total"); ImGui::TableNextColumn(); ImGui::TableNextColumn();
-        ImGui::Text("Many"); ImGui::TableNextColumn();
-        ImGui::Text("Lots"); ImGui::TableNextColumn();
-        ImGui::Text("Abundant"); ImGui::TableNextColumn();
-        ImGui::Text("Seconds"); ImGui::TableNextColumn();
-
-        ImGui::TableNextRow(); ImGui::TableNextColumn();
-        ImGui::Text("Avg."); ImGui::TableNextColumn(); ImGui::TableNextColumn();
-        ImGui::Text("Many"); ImGui::TableNextColumn();
-        ImGui::Text("Lots"); ImGui::TableNextColumn();
-        ImGui::Text("Abundant"); ImGui::TableNextColumn();
-        ImGui::Text("Seconds"); ImGui::TableNextColumn();
-        ImGui::Text("0th");
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::Text("Total"); ImGui::TableNextColumn(); ImGui::TableNextColumn();
+      ImGui::Text("Many"); ImGui::TableNextColumn();
+      ImGui::Text("Lots"); ImGui::TableNextColumn();
+      ImGui::Text("Abundant"); ImGui::TableNextColumn();
+      ImGui::Text("Seconds"); ImGui::TableNextColumn();
+
+      ImGui::TableNextRow(); ImGui::TableNextColumn();
+      ImGui::Text("Avg."); ImGui::TableNextColumn(); ImGui::TableNextColumn();
+      ImGui::Text("Many"); ImGui::TableNextColumn();
+      ImGui::Text("Lots"); ImGui::TableNextColumn();
+      ImGui::Text("Abundant"); ImGui::TableNextColumn();
+      ImGui::Text("Seconds"); ImGui::TableNextColumn();
+      ImGui::Text("0th");
+
+      ImGui::EndTable();
+    }
 
-        ImGui::EndTable();
-      }
+    ImGui::End();
+  }
+}
+
+static void draw_footer() {
+  int win3_x = 0;
+  int win3_y = top_windows_height();
+  int win3_w = WIDTH;
+  int win3_h = HEIGHT - win3_y;
 
-      ImGui::End();
+  {
+    /* Only the frame time changes, so the footer is rebuilt only when its text does.
+       Refresh it twice per second: a value changing every frame would keep the whole frame from ever being idle */
+    static char perf[64] = "";
+    static double perf_refresh_time = 0.0;
+    if (ImGui::GetTime() >= perf_refresh_time) {
+      sprintf(perf, "Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+      perf_refresh_time = ImGui::GetTime() + 0.5;
+    }
+    ImGui::SetNextWindowContentVersion(ImHashStr(perf));
+    if (create_window("footer", win3_x, win3_y, win3_w, win3_h)) {
+      ImGui::Text("%s v%s.%s.%s - Eddy, 2020/10/11.", NAME, MAJOR, MINOR, PATCH); ImGui::SameLine();
+      ImGui::TextUnformatted(perf);
     }
+    ImGui::End();
+  }
+}
+
+/* The two top windows hold the heavy tables and don't overlap anything, so each one is recorded
+   on its own thread into its own worker context. The footer is cheap and stays on the main context.
+   The threads live as long as the contexts and are woken once per frame by draw_gui() */
+static void (*const worker_windows[2])() = { draw_scores, draw_savefile };
+static ImGuiContext* worker_contexts[2] = { NULL, NULL };
+static std::thread worker_threads[2];
+static std::mutex worker_mutex;
+static std::condition_variable worker_start_cv, worker_done_cv;
+static int worker_frame = 0;       // Bumped to start a frame on every worker
+static int worker_done_count = 0;  // Workers done with worker_frame
+static bool worker_quit = false;
+
+static void record_worker_window(int i) {
+  ImGui::NewWorkerFrame(worker_contexts[i]);
+  worker_windows[i]();
+  ImGui::EndWorkerFrame();
+}
 
+static void worker_thread_main(int i) {
+  int frame = 0;
+  for (;;) {
     {
-      create_window("footer", win3_x, win3_y, win3_w, win3_h);
-      ImGui::Text("%s v%s.%s.%s - Eddy, 2020/10/11.", NAME, MAJOR, MINOR, PATCH); ImGui::SameLine();
-      ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
-      ImGui::End();
+      std::unique_lock<std::mutex> lock(worker_mutex);
+      worker_start_cv.wait(lock, [&] { return worker_quit || worker_frame != frame; });
+      if (worker_quit)
+        return;
+      frame = worker_frame;
+    }
+    record_worker_window(i);
+    {
+      std::lock_guard<std::mutex> lock(worker_mutex);
+      worker_done_count++;
     }
+    worker_done_cv.notify_one();
+  }
+}
+
+static void create_worker_contexts() {
+  worker_quit = false;
+  for (int i = 0; i < 2; i++)
+    worker_contexts[i] = ImGui::CreateWorkerContext();
+  for (int i = 0; i < 2; i++)
+    worker_threads[i] = std::thread(worker_thread_main, i);
+}
+
+static void destroy_worker_contexts() {
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex);
+    worker_quit = true;
+  }
+  worker_start_cv.notify_all();
+  for (int i = 0; i < 2; i++) {
+    worker_threads[i].join();
+    ImGui::DestroyContext(worker_contexts[i]);
+    worker_contexts[i] = NULL;
+  }
+}
+
+static void draw_gui() {
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex);
+    worker_frame++;
+    worker_done_count = 0;
+  }
+  worker_start_cv.notify_all();
+  draw_footer();
+  {
+    std::unique_lock<std::mutex> lock(worker_mutex);
+    worker_done_cv.wait(lock, [] { return worker_done_count == 2; });
+  }
+  for (int i = 0; i < 2; i++)
+    ImGui::MergeWorkerFrame(worker_contexts[i]);
+}
+
+// Render without a window or GPU, using the software rasterizer.
+// Runs 'frames' frames (timing them) and saves the last one to 'filename' as a PNG.
+static int run_headless(const char* filename, int frames) {
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = NULL;
+  headless = true;
+  io.DisplaySize = ImVec2(WIDTH, HEIGHT);
+  io.DeltaTime = 1.0f / 60.0f;
+  io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+  ImGui::StyleColorsDark();
+  create_worker_contexts();
+  ImGui_ImplSoftRaster_Init();
+
+  // Windows, tables and tab bars need a couple of frames to settle their layout
+  ImVec4 clear_color = ImVec4(0.0586f, 0.0586f, 0.0586f, 1.0f);
+  if (frames < 3) frames = 3;
+  double total_ms = 0.0;
+  for (int frame = 0; frame < frames; frame++) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    ImGui_ImplSoftRaster_NewFrame();
+    ImGui::NewFrame();
+    draw_gui();
+    ImGui::Render();
+    ImGui_ImplSoftRaster_Clear(WIDTH, HEIGHT, clear_color);
+    ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData());
+    total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  }
+  /* The last frame's allocation count shows whether the steady state touches the heap at all */
+  printf("%d frames, average %.3f ms/frame, %d heap allocations per frame\n", frames, total_ms / frames, io.MetricsFrameAllocations);
+
+  bool ok = ImGui_ImplSoftRaster_SavePNG(filename);
+  if (!ok) fprintf(stderr, "Failed to write %s\n", filename);
+
+  ImGui_ImplSoftRaster_Shutdown();
+  destroy_worker_contexts();
+  ImGui::DestroyContext();
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+  // Headless mode: imgui --screenshot file.png [frames]
+  if (argc >= 3 && strcmp(argv[1], "--screenshot") == 0)
+    return run_headless(argv[2], argc >= 4 ? atoi(argv[3]) : 3);
+
+  // Setup window
+  glfwSetErrorCallback(glfw_error_callback);
+  if (!glfwInit())
+  return 1;
+
+  // Decide GL+GLSL versions
+  #ifdef __APPLE__
+  // GL 3.2 + GLSL 150
+  const char* glsl_version = "#version 150";
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // Required on Mac
+  #else
+  // GL 3.0 + GLSL 130
+  const char* glsl_version = "#version 130";
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+  //glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
+  //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // 3.0+ only
+  #endif
+  glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
+  //glfwWindowHint(GLFW_DECORATED, GL_FALSE);
+
+  // Create window with graphics context
+  GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, NAME, NULL, NULL);
+  if (window == NULL)
+  return 1;
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(1); // Enable vsync
+
+  // Initialize OpenGL loader
+  if (gl3wInit() != 0)
+  {
+    fprintf(stderr, "Failed to initialize OpenGL loader!\n");
+    return 1;
+  }
+
+  // Setup Dear ImGui context
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO(); (void)io;
+  /* Player names can use any script, only rasterize the glyphs that are actually shown */
+  io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+  /* Reuse the baked atlas of the previous run, it is rebuilt whenever the fonts change */
+  io.Fonts->BuildCacheFilename = "imgui_fonts.cache";
+  //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
+  //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+
+  // Setup Dear ImGui style
+  ImGui::StyleColorsDark();
+  create_worker_contexts();
+
+  // Setup Platform/Renderer bindings
+  ImGui_ImplGlfw_InitForOpenGL(window, true);
+  ImGui_ImplOpenGL3_Init(glsl_version);
+  create_heatmap_texture();
+
+  // Don't create ini config file
+  io.IniFilename = NULL;
+
+  // Background
+  ImVec4 clear_color = ImVec4(0.0586f, 0.0586f, 0.0586f, 0.9375f);
+
+  // Last presented frame, see GetContentHash() below
+  frame_signature presented = { 0, 0, 0, 0, 0, 0 };
+  glfwSetWindowRefreshCallback(window, glfw_refresh_callback);
+
+  // Main loop
+  while (!glfwWindowShouldClose(window))
+  {
+    // Poll and handle events (inputs, window resize, etc.)
+    // You can read the io.WantCaptureMouse, io.WantCaptureKeyboard flags to tell if dear imgui wants to use your inputs.
+    // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
+    // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
+    // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+    glfwPollEvents();
+
+    // Start the Dear ImGui frame
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplGlfw_NewFrame();
+    ImGui::NewFrame();
+
+    draw_gui();
+    if (upload_heatmap())
+      present_needed = true;
 
     // Rendering
     ImGui::Render();
     int display_w, display_h;
     glfwGetFramebufferSize(window, &display_w, &display_h);
+
+    /* Skip the upload, draw and swap when the frame would be identical to the one on screen.
+       Without the swap there is no vsync wait, so block until an event arrives or the next refresh is due */
+    frame_signature frame = get_frame_signature(ImGui::GetDrawData(), display_w, display_h);
+    if (!present_needed && same_frame_signature(frame, presented)) {
+      glfwWaitEventsTimeout(1.0 / 60.0);
+      continue;
+    }
+    presented = frame;
+    present_needed = false;
+
     glViewport(0, 0, display_w, display_h);
     glClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -650,8 +1082,10 @@ int main(int, char**)
   }
 
   // Cleanup
+  destroy_heatmap_texture();
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplGlfw_Shutdown();
+  destroy_worker_contexts();
   ImGui::DestroyContext();
 
   glfwDestroyWindow(window);
@@ -0,0 +1,111 @@
+// Highscore boards layout, and the range and histograms of a snapshot stored by column (included by main.cpp and tests/test_scores.cpp).
+
+#pragma once
+
+#include <float.h>
+#include <string.h>
+#include "imgui/imgui.h"
+
+#if !defined(IMGUI_DISABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SCORES_SSE2
+#endif
+
+enum { BOARD_LEVEL = 1, BOARD_EPISODE = 2, BOARD_STORY = 4 };
+static const int boards_count = 2550;
+static const int board_ranks = 20;
+static const int type_first_board[3] = { 0, 1800, 2400 };  // Levels, episodes, stories
+static const int type_boards_count[3] = { 1800, 600, 150 };
+static const int score_bins_count = 100;
+
+/* Min and max of the scores of the boards in 'types_mask', NaN scores ignored. Returns false if there are none */
+static bool scores_range(const float* scores, const ImU8* types, int count, ImU8 types_mask, float* out_min, float* out_max) {
+  float v_min = FLT_MAX, v_max = -FLT_MAX;
+  int i = 0;
+#ifdef SCORES_SSE2
+  const __m128i mask4 = _mm_set1_epi32(types_mask);
+  __m128 min4 = _mm_set1_ps(FLT_MAX), max4 = _mm_set1_ps(-FLT_MAX);
+  for (; i + 4 <= count; i += 4) {
+    int t;
+    memcpy(&t, types + i, 4);
+    const __m128i t4 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(t), _mm_setzero_si128()), _mm_setzero_si128());
+    const __m128 keep = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_and_si128(t4, mask4), _mm_setzero_si128()), _mm_setzero_si128()));
+    const __m128 v = _mm_loadu_ps(scores + i);
+    // minps/maxps return their second operand when either is NaN: keep the running values there
+    min4 = _mm_min_ps(_mm_or_ps(_mm_and_ps(keep, v), _mm_andnot_ps(keep, _mm_set1_ps(FLT_MAX))), min4);
+    max4 = _mm_max_ps(_mm_or_ps(_mm_and_ps(keep, v), _mm_andnot_ps(keep, _mm_set1_ps(-FLT_MAX))), max4);
+  }
+  float mins[4], maxs[4];
+  _mm_storeu_ps(mins, min4);
+  _mm_storeu_ps(maxs, max4);
+  for (int n = 0; n < 4; n++) {
+    if (mins[n] < v_min) v_min = mins[n];
+    if (maxs[n] > v_max) v_max = maxs[n];
+  }
+#endif
+  for (; i < count; i++) {
+    if (types[i] & types_mask) {
+      if (scores[i] < v_min) v_min = scores[i];
+      if (scores[i] > v_max) v_max = scores[i];
+    }
+  }
+  *out_min = v_min;
+  *out_max = v_max;
+  return v_min <= v_max;
+}
+
+/* Adds the number of scores of the boards in 'types_mask' falling in each of the 'bins_count' bins of [v_min, v_max] to 'out_bins'.
+   Bin indices are computed 4 at a time, then counted in 4 separate histograms (one per lane) so consecutive increments never
+   wait on each other. Scores of other boards and NaN scores go to an extra bin, which is dropped */
+static void bin_scores(const float* scores, const ImU8* types, int count, ImU8 types_mask, float v_min, float v_max, int bins_count, float* out_bins) {
+  IM_ASSERT(bins_count > 0 && bins_count <= score_bins_count);
+  const float scale = (v_max > v_min) ? bins_count / (v_max - v_min) : 0.0f;
+  const int stride = bins_count + 1;
+  int counts[(score_bins_count + 1) * 4];
+  memset(counts, 0, sizeof(int) * stride * 4);
+  int i = 0;
+#ifdef SCORES_SSE2
+  const __m128i mask4 = _mm_set1_epi32(types_mask);
+  const __m128i dropped4 = _mm_set1_epi32(bins_count);
+  const __m128 min4 = _mm_set1_ps(v_min), scale4 = _mm_set1_ps(scale), last4 = _mm_set1_ps((float)(bins_count - 1));
+  int* counts0 = counts;
+  int* counts1 = counts0 + stride;
+  int* counts2 = counts1 + stride;
+  int* counts3 = counts2 + stride;
+  for (; i + 4 <= count; i += 4) {
+    int t;
+    memcpy(&t, types + i, 4);
+    const __m128i t4 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(t), _mm_setzero_si128()), _mm_setzero_si128());
+    const __m128 v = _mm_loadu_ps(scores + i);
+    const __m128i skip = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(t4, mask4), _mm_setzero_si128()), _mm_castps_si128(_mm_cmpunord_ps(v, v)));
+    const __m128 f = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(v, min4), scale4), _mm_setzero_ps()), last4);
+    const __m128i bin4 = _mm_or_si128(_mm_andnot_si128(skip, _mm_cvttps_epi32(f)), _mm_and_si128(skip, dropped4));
+    int bins[4];
+    _mm_storeu_si128((__m128i*)bins, bin4);
+    counts0[bins[0]]++;
+    counts1[bins[1]]++;
+    counts2[bins[2]]++;
+    counts3[bins[3]]++;
+  }
+#endif
+  for (; i < count; i++) {
+    if ((types[i] & types_mask) && scores[i] == scores[i]) {
+      float f = (scores[i] - v_min) * scale;
+      int bin = f <= 0.0f ? 0 : f >= bins_count - 1 ? bins_count - 1 : (int)f;
+      counts[bin]++;
+    }
+  }
+  for (int bin = 0; bin < bins_count; bin++)
+    out_bins[bin] += (float)(counts[bin] + counts[stride + bin] + counts[stride * 2 + bin] + counts[stride * 3 + bin]);
+}
+
+/* Adds the number of highscores of each rank of the boards in 'types_mask' to 'out_ranks' (board_ranks entries) */
+static void count_ranks(const ImU8* ranks, const ImU8* types, int count, ImU8 types_mask, float* out_ranks) {
+  int counts[board_ranks];
+  memset(counts, 0, sizeof(counts));
+  for (int i = 0; i < count; i++)
+    if ((types[i] & types_mask) && ranks[i] < board_ranks)
+      counts[ranks[i]]++;
+  for (int rank = 0; rank < board_ranks; rank++)
+    out_ranks[rank] += (float)counts[rank];
+}
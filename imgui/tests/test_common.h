@@ -0,0 +1,33 @@
+// Helpers shared by the tests: checks, a deterministic random generator and a clock.
+// Each test is a standalone program that returns non-zero on failure, and also prints timings when given --bench (see Makefile).
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// Print the failing condition and return false from the calling check function
+#define TEST_CHECK(_EXPR)   do { if (!(_EXPR)) { printf("%s:%d: FAILED: %s\n", __FILE__, __LINE__, #_EXPR); return false; } } while (0)
+
+static unsigned int GTestRandState = 1234567;
+
+// xorshift32, so runs are reproducible across platforms
+static inline unsigned int TestRand()
+{
+    GTestRandState ^= GTestRandState << 13;
+    GTestRandState ^= GTestRandState >> 17;
+    GTestRandState ^= GTestRandState << 5;
+    return GTestRandState;
+}
+
+// Seconds
+static inline double TestTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline bool TestIsBench(int argc, char** argv)
+{
+    return argc > 1 && strcmp(argv[1], "--bench") == 0;
+}
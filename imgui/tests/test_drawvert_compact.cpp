@@ -0,0 +1,100 @@
+// Compact ImDrawVert layout (IMGUI_DRAWVERT_POS_FIXED16 + IMGUI_DRAWVERT_UV_UNORM16): encoding ranges and rounding, and text vertices.
+// Built by the Makefile with and without IMGUI_DISABLE_SSE: both builds must output the same text vertices as the scalar encoder.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <math.h>
+
+#if !defined(IMGUI_DRAWVERT_POS_FIXED16) || !defined(IMGUI_DRAWVERT_UV_UNORM16)
+#error "Build with -DIMGUI_DRAWVERT_POS_FIXED16 -DIMGUI_DRAWVERT_UV_UNORM16"
+#endif
+
+// Hash of the vertex and index buffers of CheckTextOutput(), as output by the scalar encoder
+static const ImU32 EXPECTED_TEXT_HASH = 0xEB1906C1;
+
+static bool CheckLayout()
+{
+    TEST_CHECK(sizeof(ImDrawVert) == 12);
+    TEST_CHECK(IM_OFFSETOF(ImDrawVert, pos) == 0 && IM_OFFSETOF(ImDrawVert, uv) == 4 && IM_OFFSETOF(ImDrawVert, col) == 8);
+    return true;
+}
+
+// Positions round to the nearest 1/8 pixel and clamp to -4096..+4095.875, texture coordinates round to the nearest 1/65535 and clamp to 0..1
+static bool CheckEncoding()
+{
+    const float pos_step = 1.0f / (float)(1 << IMGUI_DRAWVERT_POS_FRAC_BITS);
+    const float pos_min = -32768.0f * pos_step, pos_max = 32767.0f * pos_step;
+    for (float v = -5000.0f; v <= 5000.0f; v += 0.37f)
+    {
+        ImDrawVert vtx;
+        vtx.pos = ImVec2(v, -v);
+        const ImVec2 pos = vtx.pos;
+        const float expected_x = ImClamp(v, pos_min, pos_max), expected_y = ImClamp(-v, pos_min, pos_max);
+        TEST_CHECK(fabsf(pos.x - expected_x) <= pos_step * 0.5f + 1e-3f && fabsf(pos.y - expected_y) <= pos_step * 0.5f + 1e-3f);
+    }
+    for (int n = -10; n <= 10; n++)
+    {
+        ImDrawVert vtx;
+        vtx.pos = ImVec2(n * pos_step, 100.0f + n * pos_step);
+        const ImVec2 pos = vtx.pos;
+        TEST_CHECK(pos.x == n * pos_step && pos.y == 100.0f + n * pos_step);
+    }
+    for (float v = -0.5f; v <= 1.5f; v += 0.000913f)
+    {
+        ImDrawVert vtx;
+        vtx.uv = ImVec2(v, 1.0f - v);
+        const ImVec2 uv = vtx.uv;
+        TEST_CHECK(fabsf(uv.x - ImSaturate(v)) <= 0.5f / 65535.0f + 1e-6f && fabsf(uv.y - ImSaturate(1.0f - v)) <= 0.5f / 65535.0f + 1e-6f);
+    }
+    return true;
+}
+
+// Lines of text at fractional positions, with clipping, through the vertex writers of RenderText()
+static bool CheckTextOutput(ImDrawList* draw_list)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(700.0f, 500.0f));
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    ImFont* font = ImGui::GetIO().Fonts->Fonts[0];
+    const char* lines[] = { "The quick brown fox jumps over the lazy dog 0123456789", "Score: 1234.567  Rank #20", "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~", "Wrapped text, wrapped text, wrapped text, wrapped text" };
+    for (int n = 0; n < 60; n++)
+    {
+        const ImVec2 pos(-20.0f + n * 13.37f, -10.0f + n * 9.125f);
+        const float font_size = font->FontSize * (1.0f + (n % 4) * 0.33f);
+        draw_list->AddText(font, font_size, pos, IM_COL32(255, 255 - n, n, 255), lines[n % IM_ARRAYSIZE(lines)], NULL, (n % 3 == 0) ? 150.0f : 0.0f);
+    }
+    ImU32 hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), 0);
+    hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+    if (hash != EXPECTED_TEXT_HASH)
+        printf("text hash %08X\n", hash);
+    TEST_CHECK(hash == EXPECTED_TEXT_HASH);
+    return true;
+}
+
+int main(int, char**)
+{
+#ifdef IMGUI_ENABLE_SSE
+    printf("Compact ImDrawVert (SSE)\n");
+#else
+    printf("Compact ImDrawVert (IMGUI_DISABLE_SSE)\n");
+#endif
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::NewFrame();
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    bool ok = CheckLayout() && CheckEncoding() && CheckTextOutput(&draw_list);
+    if (ok)
+        printf("OK\n");
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+// ImFrameArena reset and reuse, and heap allocations of steady frames (io.MetricsFrameAllocations).
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+
+// Fill allocations of random sizes across several blocks, then check none of them overlapped
+static bool FillAndCheck(ImFrameArena* arena, void** ptrs, int* sizes, int count)
+{
+    for (int n = 0; n < count; n++)
+    {
+        sizes[n] = 1 + (int)(TestRand() % 3000);
+        ptrs[n] = arena->Alloc((size_t)sizes[n]);
+        TEST_CHECK(((size_t)ptrs[n] & 15) == 0);
+        memset(ptrs[n], n & 0xFF, (size_t)sizes[n]);
+    }
+    for (int n = 0; n < count; n++)
+        for (int i = 0; i < sizes[n]; i++)
+            TEST_CHECK(((unsigned char*)ptrs[n])[i] == (n & 0xFF));
+    return true;
+}
+
+static bool CheckResetAndReuse()
+{
+    const int count = 200;
+    void* ptrs[count];
+    int sizes[count];
+    ImFrameArena arena;
+    TEST_CHECK(FillAndCheck(&arena, ptrs, sizes, count));
+    TEST_CHECK(arena.Blocks.Size > 1);
+    const int used_bytes = arena.UsedBytes;
+    const int reserved_bytes = arena.GetReservedBytes();
+
+    // Blocks of the first frame are merged into one block of their combined size
+    arena.Reset();
+    TEST_CHECK(arena.Blocks.Size == 1);
+    TEST_CHECK(arena.GetReservedBytes() == reserved_bytes);
+    TEST_CHECK(arena.UsedBytes == 0 && arena.UsedBytesPreviousFrame == used_bytes);
+
+    // Following frames of the same size are served from that block, from its start
+    const char* block_data = arena.Blocks[0].Data;
+    for (int frame = 0; frame < 3; frame++)
+    {
+        TestRand();
+        void* first = arena.Alloc(16);
+        TEST_CHECK(first == block_data);
+        TEST_CHECK(FillAndCheck(&arena, ptrs, sizes, count / 2));
+        TEST_CHECK(arena.Blocks.Size == 1 && arena.Blocks[0].Data == block_data);
+        arena.Reset();
+    }
+
+    arena.Clear();
+    TEST_CHECK(arena.Blocks.Size == 0 && arena.GetReservedBytes() == 0);
+    return true;
+}
+
+// A frame with a window, text, an input text and a transient buffer, drawing the same content every frame
+static void DrawFrame()
+{
+    static char buf[64] = "input";
+    ImGui::NewFrame();
+    ImGui::Begin("Arena");
+    ImGui::Text("Frame %d", 123);
+    ImGui::InputText("##input", buf, IM_ARRAYSIZE(buf));
+    char* transient = (char*)ImGui::MemAllocFrame(10000);
+    ImFormatString(transient, 10000, "%s %.2f", "Transient", 1.5f);
+    ImGui::TextUnformatted(transient);
+    ImGui::End();
+    ImGui::Render();
+}
+
+static bool CheckSteadyFrames()
+{
+    ImGuiContext& g = *GImGui;
+    for (int frame = 0; frame < 5; frame++)
+        DrawFrame();
+    for (int frame = 5; frame < 60; frame++)
+    {
+        DrawFrame();
+        TEST_CHECK(ImGui::GetIO().MetricsFrameAllocations == 0);
+    }
+    TEST_CHECK(g.FrameArena.UsedBytesPreviousFrame >= 10000);
+    TEST_CHECK(g.FrameArena.Blocks.Size == 1);
+    return true;
+}
+
+int main(int, char**)
+{
+    printf("ImFrameArena\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    bool ok = CheckResetAndReuse() && CheckSteadyFrames();
+    if (ok)
+        printf("OK\n");
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
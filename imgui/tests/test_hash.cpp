@@ -0,0 +1,113 @@
+// ImHashStr()/ImHashData() checks against a bitwise CRC, and hashing timings with --bench.
+// Built by the Makefile with the default CRC32, and with IMGUI_USE_CRC32C both with and without the SSE4.2 instruction.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <string>
+#include <vector>
+
+#ifdef IMGUI_USE_CRC32C
+static const ImU32 CRC_POLYNOMIAL = 0x82F63B78; // Castagnoli, reversed
+static const ImU32 CRC_CHECK_VALUE = 0xE3069283;
+#else
+static const ImU32 CRC_POLYNOMIAL = 0xEDB88320; // IEEE 802.3, reversed
+static const ImU32 CRC_CHECK_VALUE = 0xCBF43926;
+#endif
+
+// Bit by bit, with the "###" reset of ImHashStr()
+static ImU32 RefHashStr(const char* data, size_t data_size, ImU32 seed)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    for (size_t i = 0; i < data_size; i++)
+    {
+        unsigned char c = (unsigned char)data[i];
+        if (c == '#' && data_size - i - 1 >= 2 && data[i + 1] == '#' && data[i + 2] == '#')
+            crc = seed;
+        crc ^= c;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 1) ? (crc >> 1) ^ CRC_POLYNOMIAL : (crc >> 1);
+    }
+    return ~crc;
+}
+
+static bool CheckAgainstReference()
+{
+    // Many '#' so "###" shows up at every position, including across 8 bytes blocks
+    const char alphabet[] = "ab#cdef#gh##ij ##k/l#";
+    for (int iter = 0; iter < 300000; iter++)
+    {
+        char buf[80];
+        const int len = TestRand() % 70;
+        const bool many_hashes = (TestRand() & 1) != 0;
+        for (int i = 0; i < len; i++)
+            buf[i] = many_hashes ? alphabet[TestRand() % (sizeof(alphabet) - 1)] : (char)(32 + TestRand() % 95);
+        buf[len] = 0;
+        const ImU32 seed = (TestRand() & 3) ? TestRand() : 0;
+        const ImU32 ref = RefHashStr(buf, len, seed);
+        TEST_CHECK(ImHashStr(buf, 0, seed) == ref);
+        TEST_CHECK(len == 0 || ImHashStr(buf, len, seed) == ref);
+
+        // ImHashData() has no "###" handling
+        for (int i = 0; i < len; i++)
+            if (buf[i] == '#')
+                buf[i] = 'x';
+        TEST_CHECK(ImHashData(buf, len, seed) == RefHashStr(buf, len, seed));
+    }
+    TEST_CHECK(ImHashStr("123456789") == CRC_CHECK_VALUE);
+    return true;
+}
+
+// Dependent hashes of random labels, ns per call
+static void Bench()
+{
+    const int lens[] = { 4, 8, 16, 32, 64 };
+    for (int len_n = 0; len_n < IM_ARRAYSIZE(lens); len_n++)
+    {
+        const int len = lens[len_n];
+        std::vector<std::string> labels(1024);
+        for (size_t n = 0; n < labels.size(); n++)
+        {
+            labels[n].resize(len);
+            for (int i = 0; i < len; i++)
+                labels[n][i] = (char)('a' + TestRand() % 26);
+        }
+        const int reps = 4000;
+        ImU32 acc = 0;
+        double t0 = TestTime();
+        for (int r = 0; r < reps; r++)
+            for (size_t n = 0; n < labels.size(); n++)
+                acc += ImHashStr(labels[n].c_str(), 0, acc);
+        double t1 = TestTime();
+        for (int r = 0; r < reps; r++)
+            for (size_t n = 0; n < labels.size(); n++)
+                acc += ImHashStr(labels[n].c_str(), len, acc);
+        double t2 = TestTime();
+        const double call_ns = 1e9 / (reps * (double)labels.size());
+        printf("len %2d: ImHashStr(zero-terminated) %6.2f ns  ImHashStr(sized) %6.2f ns  (%u)\n", len, (t1 - t0) * call_ns, (t2 - t1) * call_ns, acc & 1);
+    }
+    const int count = 4000000;
+    ImU32 acc = 0;
+    double t0 = TestTime();
+    for (int i = 0; i < count; i++)
+        acc = ImHashData(&i, sizeof(int), acc);
+    printf("ImHashData(int) %6.2f ns  (%u)\n", (TestTime() - t0) * 1e9 / count, acc & 1);
+}
+
+int main(int argc, char** argv)
+{
+#if defined(IMGUI_USE_CRC32C) && defined(IMGUI_ENABLE_SSE)
+    printf("ImHashStr (IMGUI_USE_CRC32C)\n");
+#elif defined(IMGUI_USE_CRC32C)
+    printf("ImHashStr (IMGUI_USE_CRC32C, IMGUI_DISABLE_SSE)\n");
+#else
+    printf("ImHashStr (CRC32)\n");
+#endif
+    if (!CheckAgainstReference())
+        return 1;
+    printf("OK\n");
+    if (TestIsBench(argc, argv))
+        Bench();
+    return 0;
+}
@@ -0,0 +1,144 @@
+// GetMemStats() counters per ImGuiMemTag. Built by the Makefile with and without IMGUI_ENABLE_MEMORY_STATS: without it, all counters must stay at 0.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+
+static ImGuiMemStats GStats[ImGuiMemTag_COUNT];
+static ImGuiMemStats GTotal;
+
+static void UpdateStats()
+{
+    ImGui::GetMemStats(GStats, &GTotal);
+}
+
+// A frame with a window, a tree node and a table, so every tag gets some allocations
+static void DrawFrame()
+{
+    ImGui::NewFrame();
+    ImGui::Begin("Memory");
+    if (ImGui::TreeNode("Node"))
+        ImGui::TreePop();
+    if (ImGui::BeginTable("##table", 3))
+    {
+        for (int row = 0; row < 10; row++)
+            for (int column = 0; column < 3; column++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%d %d", row, column);
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+    ImGui::Render();
+}
+
+static bool CheckTotals()
+{
+    ImS64 bytes = 0;
+    int allocations = 0;
+    for (int n = 0; n < ImGuiMemTag_COUNT; n++)
+    {
+        TEST_CHECK(GStats[n].Bytes >= 0 && GStats[n].PeakBytes >= GStats[n].Bytes && GStats[n].TotalAllocations >= GStats[n].Allocations);
+        bytes += GStats[n].Bytes;
+        allocations += GStats[n].Allocations;
+    }
+    TEST_CHECK(GTotal.Bytes == bytes && GTotal.Allocations == allocations);
+    return true;
+}
+
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+
+static bool CheckTags()
+{
+    for (int frame = 0; frame < 3; frame++)
+        DrawFrame();
+    UpdateStats();
+    TEST_CHECK(CheckTotals());
+    TEST_CHECK(GStats[ImGuiMemTag_Windows].Bytes > 0);
+    TEST_CHECK(GStats[ImGuiMemTag_DrawLists].Bytes > 0);
+    TEST_CHECK(GStats[ImGuiMemTag_Fonts].Bytes > 0);
+    TEST_CHECK(GStats[ImGuiMemTag_Tables].Bytes > 0);
+    TEST_CHECK(GStats[ImGuiMemTag_Storage].Bytes > 0);
+    TEST_CHECK(GStats[ImGuiMemTag_AppData].Bytes == 0);
+    return true;
+}
+
+// Application allocations tagged with SetMemTag(), then freed
+static bool CheckAppData()
+{
+    UpdateStats();
+    const ImGuiMemStats before = GStats[ImGuiMemTag_AppData];
+    const ImGuiMemStats before_misc = GStats[ImGuiMemTag_Misc];
+    {
+        ImVector<char> data;
+        ImGuiMemTag prev_tag = ImGui::SetMemTag(ImGuiMemTag_AppData);
+        data.reserve(100000);
+        TEST_CHECK(ImGui::SetMemTag(prev_tag) == ImGuiMemTag_AppData);
+        UpdateStats();
+        TEST_CHECK(GStats[ImGuiMemTag_AppData].Bytes == before.Bytes + 100000);
+        TEST_CHECK(GStats[ImGuiMemTag_AppData].Allocations == before.Allocations + 1);
+        TEST_CHECK(GStats[ImGuiMemTag_AppData].TotalAllocations == before.TotalAllocations + 1);
+        TEST_CHECK(GStats[ImGuiMemTag_AppData].PeakBytes >= 100000);
+        TEST_CHECK(GStats[ImGuiMemTag_Misc].Bytes == before_misc.Bytes);
+    }
+    UpdateStats();
+    TEST_CHECK(GStats[ImGuiMemTag_AppData].Bytes == before.Bytes && GStats[ImGuiMemTag_AppData].Allocations == before.Allocations);
+    TEST_CHECK(GStats[ImGuiMemTag_AppData].PeakBytes >= 100000);
+    TEST_CHECK(CheckTotals());
+    return true;
+}
+
+// Everything allocated by the context is freed with it
+static bool CheckDestroyed()
+{
+    UpdateStats();
+    TEST_CHECK(GTotal.Bytes == 0 && GTotal.Allocations == 0);
+    TEST_CHECK(GTotal.PeakBytes > 0 && GTotal.TotalAllocations > 0);
+    return true;
+}
+
+#else
+
+static bool CheckDisabled()
+{
+    for (int frame = 0; frame < 3; frame++)
+        DrawFrame();
+    UpdateStats();
+    for (int n = 0; n < ImGuiMemTag_COUNT; n++)
+        TEST_CHECK(GStats[n].Bytes == 0 && GStats[n].PeakBytes == 0 && GStats[n].Allocations == 0 && GStats[n].TotalAllocations == 0);
+    TEST_CHECK(GTotal.Bytes == 0 && GTotal.TotalAllocations == 0);
+    TEST_CHECK(CheckTotals());
+    return true;
+}
+
+#endif
+
+int main(int, char**)
+{
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    printf("GetMemStats() (IMGUI_ENABLE_MEMORY_STATS)\n");
+#else
+    printf("GetMemStats()\n");
+#endif
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+#ifdef IMGUI_ENABLE_MEMORY_STATS
+    bool ok = CheckTags() && CheckAppData();
+    ImGui::DestroyContext();
+    ok = ok && CheckDestroyed();
+#else
+    bool ok = CheckDisabled();
+    ImGui::DestroyContext();
+#endif
+    if (ok)
+        printf("OK\n");
+    return ok ? 0 : 1;
+}
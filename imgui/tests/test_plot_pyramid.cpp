@@ -0,0 +1,211 @@
+// PlotLines()/PlotHistogram() with an ImGuiPlotPyramid checked against the same plots of the values array, and timings with --bench.
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <math.h>
+#include <vector>
+
+static const ImVec2 PLOT_SIZE(600.0f, 200.0f);
+
+struct PlotOutput
+{
+    ImDrawList* DrawList;       // Valid until the next frame
+    ImRect      FrameBb;
+    int         VtxStart, VtxEnd;
+};
+
+static std::vector<float>   GValues;
+static ImGuiPlotPyramid     GPyramid;
+
+// One frame with a single plot of GValues, from the array or from GPyramid
+static PlotOutput DrawPlotFrame(bool use_pyramid, bool histogram, float scale_min, float scale_max)
+{
+    PlotOutput out;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(1000.0f, 700.0f));
+    ImGui::Begin("Plot");
+    ImDrawList* draw_list = out.DrawList = ImGui::GetWindowDrawList();
+    out.FrameBb = ImRect(ImGui::GetCursorScreenPos(), ImGui::GetCursorScreenPos() + PLOT_SIZE);
+    out.VtxStart = draw_list->VtxBuffer.Size;
+    if (histogram && use_pyramid)
+        ImGui::PlotHistogram("##plot", GPyramid, NULL, scale_min, scale_max, PLOT_SIZE);
+    else if (histogram)
+        ImGui::PlotHistogram("##plot", GValues.data(), (int)GValues.size(), 0, NULL, scale_min, scale_max, PLOT_SIZE);
+    else if (use_pyramid)
+        ImGui::PlotLines("##plot", GPyramid, NULL, scale_min, scale_max, PLOT_SIZE);
+    else
+        ImGui::PlotLines("##plot", GValues.data(), (int)GValues.size(), 0, NULL, scale_min, scale_max, PLOT_SIZE);
+    out.VtxEnd = draw_list->VtxBuffer.Size;
+    ImGui::End();
+    ImGui::Render();
+    return out;
+}
+
+static ImU32 HashPlotVertices(const PlotOutput& out)
+{
+    return ImHashData(out.DrawList->VtxBuffer.Data + out.VtxStart, (size_t)(out.VtxEnd - out.VtxStart) * sizeof(ImDrawVert));
+}
+
+// No more values than columns: the pyramid falls back to the regular plot
+static bool CheckFewValues()
+{
+    const int counts[] = { 1, 2, 20, 400, 592 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+        for (int histogram = 0; histogram < 2; histogram++)
+        {
+            const int count = counts[count_n];
+            GValues.resize(count);
+            for (int i = 0; i < count; i++)
+                GValues[i] = (float)((i * 37) % 101) - 20.0f;
+            GPyramid.Build(GValues.data(), count);
+            const ImU32 hash_array = HashPlotVertices(DrawPlotFrame(false, histogram != 0, FLT_MAX, FLT_MAX));
+            const ImU32 hash_pyramid = HashPlotVertices(DrawPlotFrame(true, histogram != 0, FLT_MAX, FLT_MAX));
+            TEST_CHECK(hash_array == hash_pyramid);
+        }
+    return true;
+}
+
+// Many values with NaN: each histogram column spans exactly the min/max of the values it covers, computed here by brute force
+static bool CheckHistogramEnvelopes()
+{
+    const int counts[] = { 601, 1000, 4097, 100000, 1000003 };
+    const float scale_min = -100.0f, scale_max = 120.0f;
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+    {
+        const int count = counts[count_n];
+        GValues.resize(count);
+        for (int i = 0; i < count; i++)
+            GValues[i] = (TestRand() % 13 == 0) ? NAN : (float)((int)(TestRand() % 2001) - 800) * 0.1f;
+        for (int i = count / 3; i < count / 3 + 5000 && i < count; i++)
+            GValues[i] = NAN;
+        GPyramid.Build(GValues.data(), count);
+        const PlotOutput out = DrawPlotFrame(true, true, scale_min, scale_max);
+        const ImDrawList* draw_list = out.DrawList;
+
+        // Same column partition as PlotEx()
+        const ImRect inner_bb(out.FrameBb.Min + ImGui::GetStyle().FramePadding, out.FrameBb.Max - ImGui::GetStyle().FramePadding);
+        const int columns_count = (int)inner_bb.GetWidth();
+        const float column_w = inner_bb.GetWidth() / (float)columns_count;
+        int level = 0;
+        while (level + 1 < GPyramid.GetLevelsCount() && ((ImS64)columns_count << (level + 1)) <= count)
+            level++;
+        const int blocks_count = GPyramid.GetBlocksCount(level);
+        const float zero_line_t = -scale_min / (scale_max - scale_min);
+
+        int vtx_n = out.VtxStart + 4; // Frame
+        int values_covered = 0;
+        for (int column_n = 0, n = 0; column_n < columns_count; column_n++)
+        {
+            const int block_end = (int)(((ImS64)(column_n + 1) * blocks_count + columns_count - 1) / columns_count);
+            if (n == block_end)
+                continue;
+            const int v_begin = n << level, v_end = ImMin(block_end << level, count);
+            values_covered += v_end - v_begin;
+            n = block_end;
+            float v_min = FLT_MAX, v_max = -FLT_MAX;
+            for (int i = v_begin; i < v_end; i++)
+                if (GValues[i] == GValues[i])
+                {
+                    v_min = ImMin(v_min, GValues[i]);
+                    v_max = ImMax(v_max, GValues[i]);
+                }
+            if (v_min > v_max)
+                continue;
+            const float t_min = 1.0f - ImSaturate((v_min - scale_min) / (scale_max - scale_min));
+            const float t_max = 1.0f - ImSaturate((v_max - scale_min) / (scale_max - scale_min));
+            const float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMin(t_max, zero_line_t));
+            const float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMax(t_min, zero_line_t));
+            TEST_CHECK(vtx_n + 4 <= out.VtxEnd);
+            const ImVec2 p_min = draw_list->VtxBuffer[vtx_n].pos, p_max = draw_list->VtxBuffer[vtx_n + 2].pos;
+            TEST_CHECK(fabsf(p_min.x - (inner_bb.Min.x + column_n * column_w)) < 0.01f && fabsf(p_max.x - p_min.x - column_w) < 0.01f);
+            TEST_CHECK(fabsf(p_min.y - y0) < 0.01f && fabsf(p_max.y - y1) < 0.01f);
+            vtx_n += 4;
+        }
+        TEST_CHECK(vtx_n == out.VtxEnd);
+        TEST_CHECK(values_covered == count);
+    }
+    return true;
+}
+
+// Hovering a Lines plot only adds the marker after the unchanged line
+static bool CheckHoveredLines()
+{
+    const int count = 50000;
+    GValues.resize(count);
+    for (int i = 0; i < count; i++)
+        GValues[i] = sinf(i * 0.001f) * 50.0f + (float)(TestRand() % 100) * 0.1f;
+    GPyramid.Build(GValues.data(), count);
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+    DrawPlotFrame(true, false, FLT_MAX, FLT_MAX);
+    const PlotOutput out = DrawPlotFrame(true, false, FLT_MAX, FLT_MAX);
+    std::vector<ImDrawVert> vtx_not_hovered(out.DrawList->VtxBuffer.Data + out.VtxStart, out.DrawList->VtxBuffer.Data + out.VtxEnd);
+
+    io.MousePos = out.FrameBb.GetCenter();
+    DrawPlotFrame(true, false, FLT_MAX, FLT_MAX);
+    const PlotOutput out_hovered = DrawPlotFrame(true, false, FLT_MAX, FLT_MAX);
+    io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+    TEST_CHECK(out_hovered.VtxEnd - out_hovered.VtxStart > (int)vtx_not_hovered.size());
+    TEST_CHECK(memcmp(out_hovered.DrawList->VtxBuffer.Data + out_hovered.VtxStart, vtx_not_hovered.data(), vtx_not_hovered.size() * sizeof(ImDrawVert)) == 0);
+    return true;
+}
+
+// Best time of a frame holding one plot, from the array and from the pyramid
+static void Bench()
+{
+    const int counts[] = { 100000, 1000000 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+    {
+        const int count = counts[count_n];
+        GValues.resize(count);
+        float y = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            y += (float)((int)(TestRand() % 201) - 100) * 0.01f;
+            GValues[i] = y;
+        }
+        double t0 = TestTime();
+        GPyramid.Build(GValues.data(), count);
+        printf("%8d values: build %6.2f ms, %d levels\n", count, (TestTime() - t0) * 1e3, GPyramid.GetLevelsCount());
+        for (int histogram = 0; histogram < 2; histogram++)
+            for (int autoscale = 0; autoscale < 2; autoscale++)
+            {
+                const float scale_min = autoscale ? FLT_MAX : -300.0f, scale_max = autoscale ? FLT_MAX : 300.0f;
+                double best[2] = { 1e9, 1e9 };
+                for (int iter = 0; iter < 100; iter++)
+                    for (int use_pyramid = 0; use_pyramid < 2; use_pyramid++)
+                    {
+                        t0 = TestTime();
+                        DrawPlotFrame(use_pyramid != 0, histogram != 0, scale_min, scale_max);
+                        best[use_pyramid] = ImMin(best[use_pyramid], TestTime() - t0);
+                    }
+                printf("%8d values %s %s: array %8.1f us  pyramid %6.1f us\n", count, histogram ? "histogram" : "lines    ", autoscale ? "autoscale" : "fixed    ", best[0] * 1e6, best[1] * 1e6);
+            }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    printf("ImGuiPlotPyramid\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1000, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    bool ok = CheckFewValues() && CheckHistogramEnvelopes() && CheckHoveredLines();
+    if (ok)
+        printf("OK\n");
+    if (ok && TestIsBench(argc, argv))
+        Bench();
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
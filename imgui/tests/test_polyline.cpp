@@ -0,0 +1,203 @@
+// AddPolyline()/AddConvexPolyFilled() output checks, and throughput with --bench.
+// Built by the Makefile with and without IMGUI_DISABLE_SSE: both builds must output the same vertices and indices as the code before vectorization.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+// Hash of the vertex and index buffers of all CheckOutput() cases, as output by the scalar code before it was vectorized
+static const ImU32 EXPECTED_OUTPUT_HASH = 0x1807326D;
+
+// Random walk across the screen, with some repeated points
+static std::vector<ImVec2> MakeWalk(int count)
+{
+    std::vector<ImVec2> points(count);
+    float y = 300.0f;
+    for (int i = 0; i < count; i++)
+    {
+        y += ((int)(TestRand() % 21) - 10) * 0.7f;
+        points[i] = (i > 0 && TestRand() % 17 == 0) ? points[i - 1] : ImVec2(10.0f + i * (900.0f / count), ImClamp(y, 10.0f, 790.0f));
+    }
+    return points;
+}
+
+static std::vector<ImVec2> MakeCircle(int count)
+{
+    std::vector<ImVec2> points(count);
+    for (int i = 0; i < count; i++)
+        points[i] = ImVec2(400.0f + 200.0f * cosf(i * 6.2831853f / count), 300.0f + 150.0f * sinf(i * 6.2831853f / count));
+    return points;
+}
+
+static void ResetDrawList(ImDrawList* draw_list, ImDrawListFlags flags)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->Flags = flags;
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+static const ImDrawListFlags FLAGS_AA_TEX = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill;
+static const ImDrawListFlags FLAGS_AA = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+
+// All point counts around the vector widths, open and closed, thin/thick and AA/non-AA lines
+static bool CheckOutput(ImDrawList* draw_list)
+{
+    const ImDrawListFlags flags_sets[] = { FLAGS_AA_TEX, FLAGS_AA, 0 };
+    const int counts[] = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 1000, 4001 };
+    const float thicknesses[] = { 0.5f, 1.0f, 2.0f, 2.5f, 4.0f };
+    ImU32 hash = 0;
+    for (int flags_n = 0; flags_n < IM_ARRAYSIZE(flags_sets); flags_n++)
+        for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+            for (int closed = 0; closed < 2; closed++)
+                for (int thickness_n = 0; thickness_n < IM_ARRAYSIZE(thicknesses); thickness_n++)
+                {
+                    const int count = counts[count_n];
+                    ResetDrawList(draw_list, flags_sets[flags_n]);
+                    std::vector<ImVec2> walk = MakeWalk(count);
+                    draw_list->AddPolyline(walk.data(), count, IM_COL32(200, 100, 50, 255), closed != 0, thicknesses[thickness_n]);
+                    if (closed && thicknesses[thickness_n] == 1.0f)
+                    {
+                        std::vector<ImVec2> circle = MakeCircle(count);
+                        draw_list->AddConvexPolyFilled(circle.data(), count, IM_COL32(20, 100, 250, 200));
+                        draw_list->AddConvexPolyFilled(walk.data(), count, IM_COL32(20, 100, 250, 200));
+                    }
+                    hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+                    hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+                }
+    if (hash != EXPECTED_OUTPUT_HASH)
+        printf("output hash %08X\n", hash);
+    TEST_CHECK(hash == EXPECTED_OUTPUT_HASH);
+    return true;
+}
+
+// Wide zigzag crossing the clipping rectangle many times, with sharp turns
+static std::vector<ImVec2> MakeZigzag(int count)
+{
+    std::vector<ImVec2> points(count);
+    for (int i = 0; i < count; i++)
+        points[i] = ImVec2(10.0f + i * (900.0f / count), 400.0f + 350.0f * sinf(i * 0.05f) + ((int)(TestRand() % 21) - 10));
+    return points;
+}
+
+struct Triangle
+{
+    float   Values[12];     // Position and UV of each vertex
+    ImU32   Cols[3];
+    bool    operator<(const Triangle& rhs) const { return memcmp(this, &rhs, sizeof(Triangle)) < 0; }
+    bool    operator==(const Triangle& rhs) const { return memcmp(this, &rhs, sizeof(Triangle)) == 0; }
+};
+
+// Triangles of the draw list whose bounding box overlaps 'rect', sorted
+static std::vector<Triangle> GetTriangles(const ImDrawList* draw_list, const ImVec4& rect)
+{
+    std::vector<Triangle> triangles;
+    for (int idx_n = 0; idx_n + 3 <= draw_list->IdxBuffer.Size; idx_n += 3)
+    {
+        Triangle triangle;
+        ImVec2 bb_min(FLT_MAX, FLT_MAX), bb_max(-FLT_MAX, -FLT_MAX);
+        for (int n = 0; n < 3; n++)
+        {
+            const ImDrawVert& vtx = draw_list->VtxBuffer[draw_list->IdxBuffer[idx_n + n]];
+            triangle.Values[n * 4 + 0] = vtx.pos.x; triangle.Values[n * 4 + 1] = vtx.pos.y;
+            triangle.Values[n * 4 + 2] = vtx.uv.x; triangle.Values[n * 4 + 3] = vtx.uv.y;
+            bb_min = ImMin(bb_min, vtx.pos); bb_max = ImMax(bb_max, vtx.pos);
+            triangle.Cols[n] = vtx.col;
+        }
+        if (bb_max.x > rect.x && bb_max.y > rect.y && bb_min.x < rect.z && bb_min.y < rect.w)
+            triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// Lines split in visible runs by AddPolyline() must output the same triangles inside of the clipping rectangle as the whole line
+static bool CheckCulledRuns(ImDrawList* draw_list)
+{
+    const ImDrawListFlags flags_sets[] = { FLAGS_AA_TEX, FLAGS_AA, 0 };
+    const float thicknesses[] = { 1.0f, 2.5f, 6.0f };
+    const ImVec4 clip_rect(300.0f, 200.0f, 600.0f, 500.0f);
+    std::vector<ImVec2> zigzag = MakeZigzag(2000);
+    for (int flags_n = 0; flags_n < IM_ARRAYSIZE(flags_sets); flags_n++)
+        for (int thickness_n = 0; thickness_n < IM_ARRAYSIZE(thicknesses); thickness_n++)
+        {
+            ResetDrawList(draw_list, flags_sets[flags_n]);
+            draw_list->PushClipRect(ImVec2(clip_rect.x, clip_rect.y), ImVec2(clip_rect.z, clip_rect.w));
+            draw_list->AddPolyline(zigzag.data(), (int)zigzag.size(), IM_COL32_WHITE, false, thicknesses[thickness_n]);
+            const int culled_vtx_count = draw_list->VtxBuffer.Size;
+            std::vector<Triangle> culled = GetTriangles(draw_list, clip_rect);
+
+            ResetDrawList(draw_list, flags_sets[flags_n]);
+            draw_list->AddPolyline(zigzag.data(), (int)zigzag.size(), IM_COL32_WHITE, false, thicknesses[thickness_n]);
+            std::vector<Triangle> whole = GetTriangles(draw_list, clip_rect);
+
+            TEST_CHECK(culled_vtx_count < draw_list->VtxBuffer.Size / 2);
+            TEST_CHECK(culled.size() == whole.size() && std::equal(culled.begin(), culled.end(), whole.begin()));
+        }
+    return true;
+}
+
+// Score history style polylines: best of 2000 calls, in millions of vertices per second
+static void Bench(ImDrawList* draw_list)
+{
+    struct BenchCase { const char* Name; ImDrawListFlags Flags; float Thickness; bool Fill; };
+    const BenchCase cases[] =
+    {
+        { "polyline AA textured t=1.0", FLAGS_AA_TEX, 1.0f, false },
+        { "polyline AA t=1.0         ", FLAGS_AA, 1.0f, false },
+        { "polyline AA textured t=3.0", FLAGS_AA_TEX, 3.0f, false },
+        { "polyline AA t=2.5         ", FLAGS_AA, 2.5f, false },
+        { "convex fill AA            ", FLAGS_AA, 1.0f, true },
+    };
+    const int count = 5000;
+    std::vector<ImVec2> walk = MakeWalk(count);
+    std::vector<ImVec2> circle = MakeCircle(count);
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        const BenchCase& bench = cases[case_n];
+        double best = 1e9;
+        for (int iter = 0; iter < 2000; iter++)
+        {
+            ResetDrawList(draw_list, bench.Flags);
+            double t0 = TestTime();
+            if (bench.Fill)
+                draw_list->AddConvexPolyFilled(circle.data(), count, IM_COL32_WHITE);
+            else
+                draw_list->AddPolyline(walk.data(), count, IM_COL32_WHITE, false, bench.Thickness);
+            best = ImMin(best, TestTime() - t0);
+        }
+        printf("%s %d points: %6.1f us, %5.1f Mvtx/s\n", bench.Name, count, best * 1e6, draw_list->VtxBuffer.Size / (best * 1e6));
+    }
+}
+
+int main(int argc, char** argv)
+{
+#ifdef IMGUI_ENABLE_SSE
+    printf("AddPolyline (SSE)\n");
+#else
+    printf("AddPolyline (IMGUI_DISABLE_SSE)\n");
+#endif
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1000, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::NewFrame();
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    bool ok = CheckOutput(&draw_list) && CheckCulledRuns(&draw_list);
+    if (ok)
+        printf("OK\n");
+    if (ok && TestIsBench(argc, argv))
+        Bench(&draw_list);
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// scores_range()/bin_scores()/count_ranks() of the app (src/scores.h) checked against plain loops, and timings with --bench.
+// Built by the Makefile with and without IMGUI_DISABLE_SSE.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "scores.h"
+#include "test_common.h"
+#include <math.h>
+#include <vector>
+
+struct ScoresData
+{
+    std::vector<float>  Scores;
+    std::vector<ImU8>   Ranks;
+    std::vector<ImU8>   Types;
+};
+
+// Random boards, with some NaN scores and out of range ranks
+static void MakeScores(ScoresData* data, int count, bool with_nan)
+{
+    data->Scores.resize(count);
+    data->Ranks.resize(count);
+    data->Types.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        data->Scores[i] = (with_nan && TestRand() % 29 == 0) ? NAN : (float)(TestRand() % 200000) * 0.01f - 300.0f;
+        data->Ranks[i] = (ImU8)(TestRand() % 23);
+        data->Types[i] = (ImU8)(1 << (TestRand() % 3));
+    }
+}
+
+static bool CheckAgainstReference()
+{
+    ScoresData data;
+    const int counts[] = { 0, 1, 3, 4, 5, 17, 1000, boards_count * board_ranks };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+        for (int with_nan = 0; with_nan < 2; with_nan++)
+            for (int types_mask = 1; types_mask < 8; types_mask++)
+            {
+                const int count = counts[count_n];
+                MakeScores(&data, count, with_nan != 0);
+
+                float ref_min = FLT_MAX, ref_max = -FLT_MAX;
+                float ref_ranks[board_ranks] = {};
+                for (int i = 0; i < count; i++)
+                    if (data.Types[i] & types_mask)
+                    {
+                        if (data.Scores[i] == data.Scores[i])
+                        {
+                            ref_min = ImMin(ref_min, data.Scores[i]);
+                            ref_max = ImMax(ref_max, data.Scores[i]);
+                        }
+                        if (data.Ranks[i] < board_ranks)
+                            ref_ranks[data.Ranks[i]]++;
+                    }
+
+                float v_min, v_max;
+                const bool any = scores_range(data.Scores.data(), data.Types.data(), count, (ImU8)types_mask, &v_min, &v_max);
+                TEST_CHECK(any == (ref_min <= ref_max));
+                TEST_CHECK(!any || (v_min == ref_min && v_max == ref_max));
+
+                float ranks[board_ranks] = {};
+                count_ranks(data.Ranks.data(), data.Types.data(), count, (ImU8)types_mask, ranks);
+                TEST_CHECK(memcmp(ranks, ref_ranks, sizeof(ranks)) == 0);
+                if (!any)
+                    continue;
+
+                const int bins_counts[] = { 1, 7, score_bins_count };
+                for (int bins_n = 0; bins_n < IM_ARRAYSIZE(bins_counts); bins_n++)
+                {
+                    const int bins_count = bins_counts[bins_n];
+                    const float scale = (v_max > v_min) ? bins_count / (v_max - v_min) : 0.0f;
+                    float ref_bins[score_bins_count] = {};
+                    for (int i = 0; i < count; i++)
+                        if ((data.Types[i] & types_mask) && data.Scores[i] == data.Scores[i])
+                        {
+                            const float f = (data.Scores[i] - v_min) * scale;
+                            ref_bins[f <= 0.0f ? 0 : f >= bins_count - 1 ? bins_count - 1 : (int)f]++;
+                        }
+                    float bins[score_bins_count] = {};
+                    bin_scores(data.Scores.data(), data.Types.data(), count, (ImU8)types_mask, v_min, v_max, bins_count, bins);
+                    TEST_CHECK(memcmp(bins, ref_bins, sizeof(bins)) == 0);
+                }
+            }
+    return true;
+}
+
+// One histogram of each kind over a full snapshot, best of 200
+static void Bench()
+{
+    ScoresData data;
+    const int count = boards_count * board_ranks;
+    MakeScores(&data, count, false);
+    double best_bins = 1e9, best_ranks = 1e9;
+    for (int iter = 0; iter < 200; iter++)
+    {
+        float v_min, v_max, bins[score_bins_count] = {}, ranks[board_ranks] = {};
+        double t0 = TestTime();
+        scores_range(data.Scores.data(), data.Types.data(), count, BOARD_LEVEL | BOARD_EPISODE, &v_min, &v_max);
+        bin_scores(data.Scores.data(), data.Types.data(), count, BOARD_LEVEL | BOARD_EPISODE, v_min, v_max, score_bins_count, bins);
+        double t1 = TestTime();
+        count_ranks(data.Ranks.data(), data.Types.data(), count, BOARD_LEVEL | BOARD_EPISODE, ranks);
+        double t2 = TestTime();
+        best_bins = ImMin(best_bins, t1 - t0);
+        best_ranks = ImMin(best_ranks, t2 - t1);
+    }
+    printf("%d scores: range + bins %6.1f us  ranks %6.1f us\n", count, best_bins * 1e6, best_ranks * 1e6);
+}
+
+int main(int argc, char** argv)
+{
+#ifdef SCORES_SSE2
+    printf("Scores histograms (SSE2)\n");
+#else
+    printf("Scores histograms (IMGUI_DISABLE_SSE)\n");
+#endif
+    if (!CheckAgainstReference())
+        return 1;
+    printf("OK\n");
+    if (TestIsBench(argc, argv))
+        Bench();
+    return 0;
+}
@@ -0,0 +1,149 @@
+// ImGuiStorage checks against std::map, and lookup/insert timings with --bench.
+// Built twice by the Makefile: with the default sorted vector and with IMGUI_STORAGE_USE_HASH_MAP.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <map>
+#include <vector>
+
+static bool CheckAgainstMap()
+{
+    ImGuiStorage storage;
+    std::map<ImGuiID, int> ref;
+    for (int i = 0; i < 200000; i++)
+    {
+        // Some small keys (including 0) so they get hit often
+        ImGuiID key = (TestRand() % 7 == 0) ? (TestRand() % 64) : TestRand();
+        switch (TestRand() % 4)
+        {
+        case 0:
+        {
+            int v = (int)TestRand();
+            storage.SetInt(key, v);
+            ref[key] = v;
+            break;
+        }
+        case 1:
+        {
+            int* p = storage.GetIntRef(key, 42);
+            if (!ref.count(key))
+                ref[key] = 42;
+            TEST_CHECK(*p == ref[key]);
+            break;
+        }
+        default:
+        {
+            std::map<ImGuiID, int>::iterator it = ref.find(key);
+            TEST_CHECK(storage.GetInt(key, -7) == (it == ref.end() ? -7 : it->second));
+            break;
+        }
+        }
+    }
+    int valid = 0;
+    for (int n = 0; n < storage.Data.Size; n++)
+        if (storage.IsPairValid(n))
+            valid++;
+    TEST_CHECK(valid == (int)ref.size());
+    storage.SetAllInt(5);
+    for (std::map<ImGuiID, int>::iterator it = ref.begin(); it != ref.end(); ++it)
+        TEST_CHECK(storage.GetInt(it->first, 0) == 5);
+    return true;
+}
+
+static bool CheckBuildSortByKey()
+{
+    // Pairs pushed into an empty storage
+    ImGuiStorage storage;
+    for (int i = 0; i < 1000; i++)
+        storage.Data.push_back(ImGuiStorage::ImGuiStoragePair((ImGuiID)(i * 7919 + 1), i));
+    storage.Data.push_back(ImGuiStorage::ImGuiStoragePair(0, 99));
+    storage.BuildSortByKey();
+    for (int i = 0; i < 1000; i++)
+        TEST_CHECK(storage.GetInt((ImGuiID)(i * 7919 + 1), -1) == i);
+    TEST_CHECK(storage.GetInt(0, -1) == 99);
+
+    // Pairs pushed into a storage that already holds some
+    for (int i = 1000; i < 3000; i++)
+        storage.Data.push_back(ImGuiStorage::ImGuiStoragePair((ImGuiID)(i * 7919 + 1), i));
+    storage.BuildSortByKey();
+    for (int i = 0; i < 3000; i++)
+        TEST_CHECK(storage.GetInt((ImGuiID)(i * 7919 + 1), -1) == i);
+    TEST_CHECK(storage.GetInt(0, -1) == 99);
+    int valid = 0;
+    for (int n = 0; n < storage.Data.Size; n++)
+        if (storage.IsPairValid(n))
+            valid++;
+    TEST_CHECK(valid == 3001);
+    return true;
+}
+
+static bool CheckPool()
+{
+    ImPool<ImGuiTabBar> pool;
+    for (int i = 1; i <= 500; i++)
+        pool.GetOrAddByKey((ImGuiID)i * 31);
+    for (int i = 1; i <= 500; i++)
+        TEST_CHECK(pool.GetIndex(pool.GetByKey((ImGuiID)i * 31)) == i - 1);
+    pool.Clear();
+    return true;
+}
+
+// Per operation timings on random keys. 'insert' is SetInt() of new keys into a storage already holding about n keys
+// (filled with BuildSortByKey(), as one by one insertion into a sorted storage of 1M keys would take minutes).
+static void Bench()
+{
+    const int sizes[] = { 1000, 10000, 100000, 1000000 };
+    for (int size_n = 0; size_n < IM_ARRAYSIZE(sizes); size_n++)
+    {
+        const int n = sizes[size_n];
+        const int insert_n = ImMin(n, 1000);
+        std::vector<ImGuiID> keys(n), misses(n);
+        for (int i = 0; i < n; i++)
+        {
+            keys[i] = TestRand() | 1;
+            misses[i] = TestRand() & ~1u;
+        }
+        const int reps = ImMax(4000000 / n, 1);
+        double insert_time = 0.0;
+        ImGuiStorage storage;
+        for (int r = 0; r < reps; r++)
+        {
+            storage.Clear();
+            for (int i = 0; i < n - insert_n; i++)
+                storage.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[i], i));
+            storage.BuildSortByKey();
+            double t0 = TestTime();
+            for (int i = n - insert_n; i < n; i++)
+                storage.SetInt(keys[i], i);
+            insert_time += TestTime() - t0;
+        }
+        long sum = 0;
+        double t0 = TestTime();
+        for (int r = 0; r < reps; r++)
+            for (int i = 0; i < n; i++)
+                sum += storage.GetInt(keys[i], 0);
+        double t1 = TestTime();
+        for (int r = 0; r < reps; r++)
+            for (int i = 0; i < n; i++)
+                sum += storage.GetInt(misses[i], 0);
+        double t2 = TestTime();
+        const double lookup_ns = 1e9 / ((double)n * reps);
+        printf("%8d keys: insert %8.1f ns  hit %6.1f ns  miss %6.1f ns  (%ld)\n", n, insert_time * 1e9 / ((double)insert_n * reps), (t1 - t0) * lookup_ns, (t2 - t1) * lookup_ns, sum & 1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+#ifdef IMGUI_STORAGE_USE_HASH_MAP
+    printf("ImGuiStorage (IMGUI_STORAGE_USE_HASH_MAP)\n");
+#else
+    printf("ImGuiStorage (sorted)\n");
+#endif
+    if (!CheckAgainstMap() || !CheckBuildSortByKey() || !CheckPool())
+        return 1;
+    printf("OK\n");
+    if (TestIsBench(argc, argv))
+        Bench();
+    return 0;
+}
@@ -0,0 +1,209 @@
+// ImGuiTableData sorting and filtering checked against std::stable_sort, and sort timings with --bench.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static std::vector<double>      GValuesA, GValuesB;
+static std::vector<std::string> GNames;
+
+static double GetValueA(void*, int row, int) { return GValuesA[row]; }
+static double GetValueB(void*, int row, int) { return GValuesB[row]; }
+static const char* GetName(void*, int row, int, char*, int) { return GNames[row].c_str(); }
+static bool PassEvenRows(void*, int row) { return (row & 1) == 0; }
+
+// InitWidthOrWeight left to 0.0f: stretch columns (ScrollY without ScrollX) must get their default weight
+static const ImGuiTableDataColumn GColumns[] =
+{
+    { "Name", 0, 0.0f, NULL, GetName },
+    { "A", 0, 0.0f, GetValueA, NULL },
+    { "B", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, GetValueB, NULL },
+};
+
+static ImGuiTableData GTable;
+
+// Only table of the context, to set its sort specs
+static ImGuiTable* GetTable()
+{
+    return ImGui::GetCurrentContext()->Tables.GetByIndex(0);
+}
+
+static void DrawTableFrame()
+{
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+    ImGui::Begin("Table");
+    if (GTable.Begin("##table", GColumns, IM_ARRAYSIZE(GColumns), (int)GNames.size(), NULL, ImGuiTableFlags_Sortable | ImGuiTableFlags_MultiSortable | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 500.0f)))
+    {
+        while (GTable.Step())
+            for (int i = GTable.DisplayStart; i < GTable.DisplayEnd; i++)
+                GTable.RowText(GTable.RowsOrder[i]);
+        GTable.End();
+    }
+    ImGui::End();
+    ImGui::Render();
+}
+
+// Names sharing long prefixes, ending on and around 8 bytes boundaries, so the text sort has to look past its first keys
+static void MakeRows(int count)
+{
+    static const char* const prefixes[] = { "", "p", "player_1", "player_1x", "player_1xx", "player_12345678", "player_12345678_9", "n0", "N" };
+    GValuesA.resize(count);
+    GValuesB.resize(count);
+    GNames.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        GValuesA[i] = (double)((int)(TestRand() % 50) - 25) + ((TestRand() % 3 == 0) ? 0.5 : 0.0);
+        GValuesB[i] = (double)(TestRand() % 7) * 1e6 - 3e6 + (double)(TestRand() % 1000) * 1e-3;
+        GNames[i] = prefixes[TestRand() % IM_ARRAYSIZE(prefixes)];
+        const int suffix_len = (TestRand() % 2) ? 0 : (int)(TestRand() % 3);
+        for (int n = 0; n < suffix_len; n++)
+            GNames[i] += (char)('a' + TestRand() % 3);
+    }
+}
+
+static int CompareColumn(int column_n, bool descending, int row_a, int row_b)
+{
+    int cmp;
+    if (column_n == 0)
+        cmp = strcmp(GNames[row_a].c_str(), GNames[row_b].c_str());
+    else
+    {
+        const double a = (column_n == 1) ? GValuesA[row_a] : GValuesB[row_a];
+        const double b = (column_n == 1) ? GValuesA[row_b] : GValuesB[row_b];
+        cmp = (a < b) ? -1 : (a > b) ? 1 : 0;
+    }
+    return descending ? -cmp : cmp;
+}
+
+struct SortCase { int Column0; bool Descending0; int Column1; bool Descending1; };
+
+static bool CheckSorts()
+{
+    const int counts[] = { 5, 40, 3000 };
+    const SortCase cases[] = { { 0, false, -1, false }, { 0, true, -1, false }, { 1, false, 2, true }, { 2, true, 0, false }, { 0, true, 1, false }, { 1, true, 0, true } };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+    {
+        MakeRows(counts[count_n]);
+        DrawTableFrame();
+        ImGuiTable* table = GetTable();
+        TEST_CHECK(table != NULL);
+        for (int filter = 0; filter < 2; filter++)
+            for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+            {
+                const SortCase& sort = cases[case_n];
+                GTable.PassFilter = filter ? PassEvenRows : NULL;
+                GTable.SetDirty();
+                ImGui::TableSetColumnSortDirection(table, sort.Column0, sort.Descending0 ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending, false);
+                if (sort.Column1 >= 0)
+                    ImGui::TableSetColumnSortDirection(table, sort.Column1, sort.Descending1 ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending, true);
+                DrawTableFrame();
+
+                std::vector<int> expected;
+                for (int row = 0; row < (int)GNames.size(); row++)
+                    if (!filter || (row & 1) == 0)
+                        expected.push_back(row);
+                std::stable_sort(expected.begin(), expected.end(), [&](int row_a, int row_b)
+                {
+                    int cmp = CompareColumn(sort.Column0, sort.Descending0, row_a, row_b);
+                    if (cmp == 0 && sort.Column1 >= 0)
+                        cmp = CompareColumn(sort.Column1, sort.Descending1, row_a, row_b);
+                    return cmp < 0;
+                });
+                TEST_CHECK(GTable.RowsOrder.Size == (int)expected.size());
+                TEST_CHECK(memcmp(GTable.RowsOrder.Data, expected.data(), expected.size() * sizeof(int)) == 0);
+            }
+        GTable.PassFilter = NULL;
+    }
+    return true;
+}
+
+// A text shorter than 8 bytes first, then longer texts sharing its first 8 bytes
+static bool CheckSharedPrefixes()
+{
+    GNames.resize(0);
+    GNames.push_back("player_1");
+    for (int i = 0; i < 40; i++)
+        GNames.push_back((TestRand() & 1) ? "player_1xx" : "player_1x");
+    GValuesA.assign(GNames.size(), 0.0);
+    GValuesB.assign(GNames.size(), 0.0);
+    DrawTableFrame();
+    ImGuiTable* table = GetTable();
+    ImGui::TableSetColumnSortDirection(table, 0, ImGuiSortDirection_Ascending, false);
+    GTable.SetDirty();
+    DrawTableFrame();
+    for (int i = 1; i < GTable.RowsOrder.Size; i++)
+        TEST_CHECK(GNames[GTable.RowsOrder[i - 1]] <= GNames[GTable.RowsOrder[i]]);
+    return true;
+}
+
+static bool CheckTextFilter()
+{
+    MakeRows(2000);
+    ImGuiTextFilter filter("player_1x,n0");
+    GTable.Filter = &filter;
+    GTable.SetDirty();
+    DrawTableFrame();
+    int expected = 0;
+    for (int row = 0; row < (int)GNames.size(); row++)
+        if (GNames[row].find("player_1x") != std::string::npos || GNames[row].find("n0") != std::string::npos)
+            expected++;
+    GTable.Filter = NULL;
+    GTable.SetDirty();
+    TEST_CHECK(GTable.RowsOrder.Size == expected);
+    return true;
+}
+
+// Frame where the sort specs change, sorting on a value then on a text column
+static void Bench()
+{
+    const int counts[] = { 100000, 1000000 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+    {
+        MakeRows(counts[count_n]);
+        for (int i = 0; i < counts[count_n]; i++)
+        {
+            char buf[32];
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "n%05d", (int)(TestRand() % 30000));
+            GNames[i] = buf;
+        }
+        DrawTableFrame();
+        ImGuiTable* table = GetTable();
+        double best = 1e9;
+        for (int iter = 0; iter < 5; iter++)
+        {
+            ImGui::TableSetColumnSortDirection(table, 1 + (iter & 1), ImGuiSortDirection_Descending, false);
+            ImGui::TableSetColumnSortDirection(table, 0, ImGuiSortDirection_Ascending, true);
+            double t0 = TestTime();
+            DrawTableFrame();
+            best = ImMin(best, TestTime() - t0);
+        }
+        printf("%8d rows: value + text sort frame %7.2f ms\n", counts[count_n], best * 1e3);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    printf("ImGuiTableData\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    bool ok = CheckSorts() && CheckSharedPrefixes() && CheckTextFilter();
+    if (ok)
+        printf("OK\n");
+    if (ok && TestIsBench(argc, argv))
+        Bench();
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
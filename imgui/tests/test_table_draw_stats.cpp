@@ -0,0 +1,209 @@
+// ImDrawListSplitter::Merge() checked against drawing the channels one after the other, and the draw stats of tables (LastDrawCmdCount, LastDrawMergeBytes) checked against what they add to the host draw list.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <vector>
+
+// One shape drawn in a channel, with its own clip rect so channels can be replayed in any order
+struct DrawOp
+{
+    int     Channel;
+    int     Type;       // 0: filled rect, 1: callback, 2: clip rect pushed and popped without drawing
+    ImVec4  ClipRect;
+    ImVec2  Pos;
+    ImU32   Col;
+};
+
+static void DummyCallback(const ImDrawList*, const ImDrawCmd*)
+{
+}
+
+static void DrawOpTo(ImDrawList* draw_list, const DrawOp& op)
+{
+    if (op.Type == 1)
+    {
+        draw_list->AddCallback(DummyCallback, (void*)(intptr_t)op.Col);
+        return;
+    }
+    draw_list->PushClipRect(ImVec2(op.ClipRect.x, op.ClipRect.y), ImVec2(op.ClipRect.z, op.ClipRect.w));
+    if (op.Type == 0)
+        draw_list->AddRectFilled(op.Pos, ImVec2(op.Pos.x + 10.0f, op.Pos.y + 10.0f), op.Col);
+    draw_list->PopClipRect();
+}
+
+// Triangles in command order (positions, colors and clip rects), callbacks as markers. Also checks that the commands indices are contiguous.
+static bool GetOutput(const ImDrawList* draw_list, std::vector<float>* out_values, int* out_cmd_count)
+{
+    out_values->clear();
+    *out_cmd_count = 0;
+    unsigned int idx_offset = 0;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+        TEST_CHECK(cmd.IdxOffset == idx_offset);
+        idx_offset += cmd.ElemCount;
+        if (cmd.UserCallback != NULL)
+        {
+            out_values->push_back(-1.0f);
+            out_values->push_back((float)(intptr_t)cmd.UserCallbackData);
+            continue;
+        }
+        if (cmd.ElemCount > 0)
+            (*out_cmd_count)++;
+        for (unsigned int elem_n = 0; elem_n < cmd.ElemCount; elem_n++)
+        {
+            const ImDrawVert& vtx = draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + elem_n]];
+            const float values[] = { vtx.pos.x, vtx.pos.y, (float)vtx.col, cmd.ClipRect.x, cmd.ClipRect.y, cmd.ClipRect.z, cmd.ClipRect.w };
+            out_values->insert(out_values->end(), values, values + IM_ARRAYSIZE(values));
+        }
+    }
+    TEST_CHECK(idx_offset == (unsigned int)draw_list->IdxBuffer.Size);
+    return true;
+}
+
+// Random shapes drawn in random channels, with clip rects often shared so that the first commands of channels get merged into the previous channel
+static bool CheckSplitterMerge()
+{
+    const ImVec4 clip_rects[] = { ImVec4(0, 0, 800, 600), ImVec4(10, 10, 200, 300), ImVec4(200, 10, 400, 300), ImVec4(0, 0, 100, 100) };
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list_reference(ImGui::GetDrawListSharedData());
+    ImDrawListSplitter splitter;
+    std::vector<DrawOp> ops;
+    std::vector<float> output, output_reference;
+    for (int iteration = 0; iteration < 3000; iteration++)
+    {
+        const int channels_count = 1 + (int)(TestRand() % 12);
+        const int ops_count = (int)(TestRand() % 40);
+        ops.clear();
+        for (int n = 0; n < ops_count; n++)
+        {
+            DrawOp op;
+            op.Channel = (int)(TestRand() % channels_count);
+            op.Type = (TestRand() % 10 == 0) ? 1 : (TestRand() % 10 == 0) ? 2 : 0;
+            op.ClipRect = clip_rects[TestRand() % IM_ARRAYSIZE(clip_rects)];
+            op.Pos = ImVec2((float)(TestRand() % 400), (float)(TestRand() % 400));
+            op.Col = IM_COL32(n, iteration & 0xFF, 128, 255);
+            ops.push_back(op);
+        }
+
+        // Host content before splitting: nothing, or shapes in a clip rect some channels will share
+        const int host_ops_count = (int)(TestRand() % 3);
+        draw_list._ResetForNewFrame();
+        draw_list.PushClipRectFullScreen();
+        draw_list_reference._ResetForNewFrame();
+        draw_list_reference.PushClipRectFullScreen();
+        for (int n = 0; n < host_ops_count; n++)
+        {
+            DrawOp op = { 0, 0, clip_rects[0], ImVec2(5.0f * n, 5.0f), IM_COL32(255, 0, 0, 255) };
+            DrawOpTo(&draw_list, op);
+            DrawOpTo(&draw_list_reference, op);
+        }
+
+        splitter.Split(&draw_list, channels_count);
+        for (int n = 0; n < (int)ops.size(); n++)
+        {
+            splitter.SetCurrentChannel(&draw_list, ops[n].Channel);
+            DrawOpTo(&draw_list, ops[n]);
+        }
+        splitter.Merge(&draw_list);
+        for (int channel_n = 0; channel_n < channels_count; channel_n++)
+            for (int n = 0; n < (int)ops.size(); n++)
+                if (ops[n].Channel == channel_n)
+                    DrawOpTo(&draw_list_reference, ops[n]);
+
+        int cmd_count, cmd_count_reference;
+        TEST_CHECK(GetOutput(&draw_list, &output, &cmd_count));
+        TEST_CHECK(GetOutput(&draw_list_reference, &output_reference, &cmd_count_reference));
+        TEST_CHECK(output == output_reference);
+        TEST_CHECK(cmd_count == cmd_count_reference);
+    }
+    splitter.ClearFreeMemory();
+    return true;
+}
+
+static int GetUsedCmdCount(const ImDrawList* draw_list)
+{
+    int count = 0;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        if (draw_list->CmdBuffer[cmd_n].ElemCount > 0)
+            count++;
+    return count;
+}
+
+// Tables with and without host content before them, narrow columns clipping their text, and channel 0 output (borders, row backgrounds)
+static bool CheckTableStats()
+{
+    const ImGuiTableFlags flags_list[] = { ImGuiTableFlags_None, ImGuiTableFlags_NoClip, ImGuiTableFlags_Resizable, ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable, ImGuiTableFlags_Borders, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV };
+    for (int case_n = 0; case_n < 200; case_n++)
+    {
+        const ImGuiTableFlags flags = flags_list[TestRand() % IM_ARRAYSIZE(flags_list)];
+        const bool host_text = (TestRand() % 2) == 0;
+        const int columns_count = 1 + (int)(TestRand() % 6);
+        const int text_length = 1 + (int)(TestRand() % 30);
+        const float column_width = 20.0f + (float)(TestRand() % 100);
+
+        // Second frame: column widths are settled
+        for (int frame = 0; frame < 2; frame++)
+        {
+            ImGui::NewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+            ImGui::SetNextWindowSize(ImVec2(780.0f, 580.0f));
+            ImGui::Begin("Tables", NULL, ImGuiWindowFlags_NoTitleBar);
+            if (host_text)
+                ImGui::Text("Host");
+            ImDrawList* draw_list = ImGui::GetWindowDrawList();
+            const int cmd_count_before = GetUsedCmdCount(draw_list);
+            const int idx_count_before = draw_list->IdxBuffer.Size;
+            ImGui::PushID(case_n);
+            if (ImGui::BeginTable("##table", columns_count, flags))
+            {
+                for (int column_n = 0; column_n < columns_count; column_n++)
+                    ImGui::TableSetupColumn("Column", ImGuiTableColumnFlags_WidthFixed, column_width);
+                for (int row = 0; row < 4; row++)
+                    for (int column_n = 0; column_n < columns_count; column_n++)
+                    {
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.*s", text_length, "Some cell contents which can be quite long");
+                    }
+                ImGuiTable* table = ImGui::GetCurrentContext()->CurrentTable;
+                ImGui::EndTable();
+
+                // Commands the table added to the host draw list. Without channel 0 output (borders, also enforced by Resizable, and row backgrounds), all of its indices and commands were copied by the merge.
+                const int cmd_count_added = GetUsedCmdCount(draw_list) - cmd_count_before;
+                const int idx_count_added = draw_list->IdxBuffer.Size - idx_count_before;
+                TEST_CHECK(table->LastDrawCmdCount == cmd_count_added);
+                if ((table->Flags & (ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) == 0)
+                    TEST_CHECK(table->LastDrawMergeBytes == cmd_count_added * (int)sizeof(ImDrawCmd) + idx_count_added * (int)sizeof(ImDrawIdx));
+                if (flags & ImGuiTableFlags_NoClip)
+                    TEST_CHECK(table->LastDrawChannelsCount == 2);
+            }
+            ImGui::PopID();
+            ImGui::End();
+            ImGui::Render();
+        }
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    printf("Table draw channels\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::NewFrame();
+    ImGui::EndFrame();
+
+    bool ok = CheckSplitterMerge() && CheckTableStats();
+    if (ok)
+        printf("OK\n");
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+// Tables reusing their columns widths across frames (ImGuiTable::IsLayoutDirty): checked against the same frames with the width pass forced every frame.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <vector>
+
+// Every frame_n % SEGMENT_FRAMES == 0 applies one change, the last frames of each segment must reuse the widths
+static const int SEGMENT_FRAMES = 8;
+static const int SEGMENTS_COUNT = 12;
+
+struct TableCase { const char* Name; ImGuiTableFlags Flags; ImGuiTableColumnFlags ColumnFlags[4]; };
+
+static const TableCase GTables[] =
+{
+    { "##mixed", ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable, { ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthStretch, ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthStretch } },
+    { "##scroll", ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY, { ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthFixed } },
+    { "##auto", ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable, { ImGuiTableColumnFlags_WidthAlwaysAutoResize, ImGuiTableColumnFlags_WidthFixed, ImGuiTableColumnFlags_WidthAlwaysAutoResize, ImGuiTableColumnFlags_WidthStretch } },
+};
+
+// Inputs of the frame changed by the script
+struct FrameState
+{
+    float               WindowWidth;
+    ImGuiTableFlags     ExtraFlags;
+    ImGuiTableColumnFlags Column3Flags;
+    float               CellPaddingX;
+    int                 TextLength;
+};
+
+static void ApplyChange(ImGuiContext* ctx, int segment, FrameState* state)
+{
+    ImGuiTable* table = ctx->Tables.GetByIndex(segment % IM_ARRAYSIZE(GTables));
+    switch (segment)
+    {
+    case 1: case 7: state->WindowWidth -= 130.0f; break;
+    case 2: case 8: ImGui::TableSetColumnWidth(table, &table->Columns[0], 150.0f); break;
+    case 3: table->ReorderColumn = 0; table->ReorderColumnDir = +1; break;
+    case 4: table->Columns[2].IsVisibleNextFrame = false; break;
+    case 5: table->Columns[2].IsVisibleNextFrame = true; state->ExtraFlags = ImGuiTableFlags_BordersInnerV; break;
+    case 6: state->TextLength += 12; state->Column3Flags = ImGuiTableColumnFlags_WidthFixed; break;
+    case 9: state->CellPaddingX = 9.0f; break;
+    case 10: ImGui::TableSetColumnAutofit(table, 1); break;
+    case 11: table->IsResetDisplayOrderRequest = true; break;
+    }
+}
+
+// Draw every table, return the layout of all columns
+static std::vector<float> DrawFrame(const FrameState& state, bool force_width_pass, bool* out_any_layout_dirty)
+{
+    std::vector<float> layout;
+    *out_any_layout_dirty = false;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(state.WindowWidth, 700.0f));
+    ImGui::Begin("Tables");
+    ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(state.CellPaddingX, 2.0f));
+    for (int table_n = 0; table_n < IM_ARRAYSIZE(GTables); table_n++)
+    {
+        const TableCase& table_case = GTables[table_n];
+        if (!ImGui::BeginTable(table_case.Name, 4, table_case.Flags | state.ExtraFlags, ImVec2(0.0f, 200.0f)))
+            continue;
+        for (int column_n = 0; column_n < 4; column_n++)
+        {
+            const ImGuiTableColumnFlags column_flags = (column_n == 3 && table_n != 1) ? state.Column3Flags : table_case.ColumnFlags[column_n];
+            ImGui::TableSetupColumn("Column", column_flags, (column_flags & ImGuiTableColumnFlags_WidthFixed) ? 60.0f + column_n * 10.0f : -1.0f);
+        }
+        ImGuiTable* table = ImGui::GetCurrentContext()->CurrentTable;
+        if (force_width_pass)
+            table->IsLayoutDirty = true;
+        *out_any_layout_dirty |= table->IsLayoutDirty;
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 5; row++)
+            for (int column_n = 0; column_n < 4; column_n++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.*s", state.TextLength + row + column_n * 3, "Some cell contents which can be quite long in places, some cell contents");
+            }
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        {
+            const ImGuiTableColumn& column = table->Columns[column_n];
+            const float values[] = { (float)column.Flags, (float)column.DisplayOrder, column.WidthRequest, column.WidthGiven, column.MinX, column.MaxX, column.ClipRect.Min.x, column.ClipRect.Max.x, (float)column.IsClipped, (float)column.IsVisible };
+            layout.insert(layout.end(), values, values + IM_ARRAYSIZE(values));
+        }
+        layout.push_back(table->ColumnsTotalWidth);
+        ImGui::EndTable();
+    }
+    ImGui::PopStyleVar();
+    ImGui::End();
+    ImGui::Render();
+    return layout;
+}
+
+static ImGuiContext* CreateTestContext(ImFontAtlas* atlas)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1000, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    return ctx;
+}
+
+static bool CheckCachedLayout(ImGuiContext* ctx_cached, ImGuiContext* ctx_reference)
+{
+    FrameState state_cached = { 900.0f, 0, ImGuiTableColumnFlags_WidthStretch, 4.0f, 4 };
+    FrameState state_reference = state_cached;
+    for (int frame_n = 0; frame_n < SEGMENT_FRAMES * SEGMENTS_COUNT; frame_n++)
+    {
+        const int segment = frame_n / SEGMENT_FRAMES;
+        if (frame_n % SEGMENT_FRAMES == 0 && segment > 0)
+        {
+            ImGui::SetCurrentContext(ctx_cached);
+            ApplyChange(ctx_cached, segment, &state_cached);
+            ImGui::SetCurrentContext(ctx_reference);
+            ApplyChange(ctx_reference, segment, &state_reference);
+        }
+        bool layout_dirty, unused;
+        ImGui::SetCurrentContext(ctx_cached);
+        std::vector<float> cached = DrawFrame(state_cached, false, &layout_dirty);
+        ImGui::SetCurrentContext(ctx_reference);
+        std::vector<float> reference = DrawFrame(state_reference, true, &unused);
+        if (cached != reference)
+            printf("frame %d: layouts differ\n", frame_n);
+        TEST_CHECK(cached == reference);
+        if (frame_n % SEGMENT_FRAMES >= SEGMENT_FRAMES - 2)
+            TEST_CHECK(!layout_dirty);
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    printf("Table layout cache\n");
+    ImFontAtlas atlas;
+    unsigned char* pixels;
+    int width, height;
+    atlas.GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGuiContext* ctx_cached = CreateTestContext(&atlas);
+    ImGuiContext* ctx_reference = CreateTestContext(&atlas);
+
+    bool ok = CheckCachedLayout(ctx_cached, ctx_reference);
+    if (ok)
+        printf("OK\n");
+
+    ImGui::DestroyContext(ctx_reference);
+    ImGui::DestroyContext(ctx_cached);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+// CalcTextSize() cache: cached sizes checked against the direct measure, and timings with --bench.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <string>
+#include <vector>
+
+// Random texts with spaces, line breaks, '##' markers and UTF-8 characters, of 0 to 80 bytes
+static std::vector<std::string> MakeTexts(int count)
+{
+    static const char* const pieces[] = { "a", "W", "i", " ", "  ", "\n", "##", "#", "0123", "\xC3\xA9", "\xE2\x82\xAC", "Label", "." };
+    std::vector<std::string> texts(count);
+    for (int i = 0; i < count; i++)
+        while (texts[i].size() < TestRand() % 80)
+            texts[i] += pieces[TestRand() % IM_ARRAYSIZE(pieces)];
+    return texts;
+}
+
+// Same measure as CalcTextSize(), without the cache
+static ImVec2 CalcTextSizeUncached(const char* text, bool hide_text_after_double_hash, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    const char* text_end = hide_text_after_double_hash ? ImGui::FindRenderedTextEnd(text) : text + strlen(text);
+    if (text == text_end)
+        return ImVec2(0.0f, g.FontSize);
+    ImVec2 text_size = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, wrap_width, text, text_end, NULL);
+    text_size.x = IM_FLOOR(text_size.x + 0.95f);
+    return text_size;
+}
+
+static void BeginTestFrame()
+{
+    ImGui::NewFrame();
+    ImGui::Begin("Text size");
+}
+
+static void EndTestFrame()
+{
+    ImGui::End();
+    ImGui::Render();
+}
+
+// More texts than cache entries, measured twice with different font sizes and wrap widths
+static bool CheckCachedSizes()
+{
+    const std::vector<std::string> texts = MakeTexts(IMGUI_TEXT_SIZE_CACHE_SIZE * 3);
+    const float font_scales[] = { 1.0f, 1.5f, 0.75f };
+    const float wrap_widths[] = { -1.0f, 0.0f, 40.0f, 120.0f };
+    for (int pass = 0; pass < 2; pass++)
+    {
+        BeginTestFrame();
+        for (int scale_n = 0; scale_n < IM_ARRAYSIZE(font_scales); scale_n++)
+        {
+            ImGui::SetWindowFontScale(font_scales[scale_n]);
+            for (int wrap_n = 0; wrap_n < IM_ARRAYSIZE(wrap_widths); wrap_n++)
+                for (int i = 0; i < (int)texts.size(); i++)
+                    for (int hide = 0; hide < 2; hide++)
+                    {
+                        const char* text = texts[i].c_str();
+                        const ImVec2 expected = CalcTextSizeUncached(text, hide != 0, wrap_widths[wrap_n]);
+                        const ImVec2 size = ImGui::CalcTextSize(text, NULL, hide != 0, wrap_widths[wrap_n]);
+                        TEST_CHECK(size.x == expected.x && size.y == expected.y);
+                    }
+        }
+        EndTestFrame();
+    }
+    ImGuiContext& g = *GImGui;
+    TEST_CHECK(g.TextSizeCacheHitsPreviousFrame > 0);
+    return true;
+}
+
+// An entry with the key of a text but measured for other parameters must not be returned
+static bool CheckKeyCollision()
+{
+    ImGuiContext& g = *GImGui;
+    const char* text = "Some text longer than IMGUI_TEXT_SIZE_CACHE_MIN_LEN";
+    BeginTestFrame();
+    g.TextSizeCache.clear();
+    const ImVec2 expected = ImGui::CalcTextSize(text);
+    ImGuiTextSizeCacheEntry* entry = NULL;
+    for (int n = 0; n < g.TextSizeCache.Size; n++)
+        if (g.TextSizeCache[n].Key != 0)
+            entry = &g.TextSizeCache[n];
+    TEST_CHECK(entry != NULL);
+
+    const ImGuiTextSizeCacheEntry backup = *entry;
+    entry->Size = ImVec2(1.0f, 1.0f);
+    entry->TextLength++;
+    TEST_CHECK(ImGui::CalcTextSize(text).x == expected.x);
+    *entry = backup;
+    entry->Size = ImVec2(1.0f, 1.0f);
+    entry->FontSize *= 2.0f;
+    TEST_CHECK(ImGui::CalcTextSize(text).x == expected.x);
+    *entry = backup;
+    entry->Size = ImVec2(1.0f, 1.0f);
+    entry->WrapWidth = 100.0f;
+    TEST_CHECK(ImGui::CalcTextSize(text).x == expected.x);
+    *entry = backup;
+    entry->Size = ImVec2(1.0f, 1.0f);
+    TEST_CHECK(ImGui::CalcTextSize(text).x == 1.0f);
+    EndTestFrame();
+    return true;
+}
+
+// Labels measured every frame: cached against direct measure, best of 20 frames
+static void Bench()
+{
+    const std::vector<std::string> texts = MakeTexts(2000);
+    double best_cached = 1e9, best_uncached = 1e9;
+    for (int iter = 0; iter < 20; iter++)
+    {
+        BeginTestFrame();
+        float sum = 0.0f;
+        double t0 = TestTime();
+        for (int i = 0; i < (int)texts.size(); i++)
+            sum += ImGui::CalcTextSize(texts[i].c_str()).x;
+        double t1 = TestTime();
+        for (int i = 0; i < (int)texts.size(); i++)
+            sum += CalcTextSizeUncached(texts[i].c_str(), true, -1.0f).x;
+        double t2 = TestTime();
+        EndTestFrame();
+        best_cached = ImMin(best_cached, t1 - t0);
+        best_uncached = ImMin(best_uncached, t2 - t1);
+        IM_UNUSED(sum);
+    }
+    printf("%d texts: cached %6.1f us, uncached %6.1f us\n", (int)texts.size(), best_cached * 1e6, best_uncached * 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    printf("CalcTextSize() cache\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    bool ok = CheckCachedSizes() && CheckKeyCollision();
+    if (ok)
+        printf("OK\n");
+    if (ok && TestIsBench(argc, argv))
+        Bench();
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
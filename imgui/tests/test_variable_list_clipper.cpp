@@ -0,0 +1,152 @@
+// ImGuiVariableListClipper: Fenwick tree prefix sums and seeks checked against linear sums, and displayed items of a scrolled list.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+#include <vector>
+
+// Whole pixel heights, so float sums are exact and can be compared with ==
+static float RandomHeight()
+{
+    return (float)(1 + TestRand() % 60);
+}
+
+// Offsets and seeks of every item against linear sums of 'heights'
+static bool CheckAgainstLinearSums(const ImGuiVariableListClipper& clipper, const std::vector<float>& heights)
+{
+    const int count = (int)heights.size();
+    TEST_CHECK(clipper.ItemsHeight.Size == count && clipper.ItemsHeightTree.Size == count);
+    float offset = 0.0f;
+    for (int n = 0; n <= count; n++)
+    {
+        TEST_CHECK(clipper.GetItemOffset(n) == offset);
+        if (n < count)
+        {
+            TEST_CHECK(clipper.ItemsHeight[n] == heights[n]);
+            TEST_CHECK(clipper.FindItemAtOffset(offset) == n);
+            TEST_CHECK(clipper.FindItemAtOffset(offset + heights[n] * 0.5f) == n);
+            offset += heights[n];
+        }
+    }
+    TEST_CHECK(clipper.FindItemAtOffset(-100.0f) == 0);
+    TEST_CHECK(clipper.FindItemAtOffset(offset + 100.0f) == ImMax(count - 1, 0));
+    return true;
+}
+
+// Random height updates, then the list growing (incremental tree update) and shrinking, then InvalidateHeights()
+static bool CheckPrefixSums()
+{
+    const int counts[] = { 0, 1, 2, 3, 7, 8, 9, 100, 1000, 4097 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(counts); count_n++)
+    {
+        const int count = counts[count_n];
+        ImGui::NewFrame();
+        ImGui::Begin("Clipper");
+        ImGuiVariableListClipper clipper;
+        clipper.Begin(count, 10.0f);
+        std::vector<float> heights(count, 10.0f);
+        TEST_CHECK(CheckAgainstLinearSums(clipper, heights));
+        for (int n = 0; n < count * 2; n++)
+        {
+            const int item = (int)(TestRand() % count);
+            heights[item] = RandomHeight();
+            clipper.SetItemHeight(item, heights[item]);
+        }
+        TEST_CHECK(CheckAgainstLinearSums(clipper, heights));
+        clipper.End();
+
+        const int grown_count = count + 1 + (int)(TestRand() % 300);
+        clipper.Begin(grown_count, 10.0f);
+        heights.resize(grown_count, 10.0f);
+        TEST_CHECK(CheckAgainstLinearSums(clipper, heights));
+        clipper.End();
+
+        const int shrunk_count = count / 2;
+        clipper.Begin(shrunk_count, 10.0f);
+        heights.resize(shrunk_count);
+        TEST_CHECK(CheckAgainstLinearSums(clipper, heights));
+        clipper.InvalidateHeights();
+        heights.assign(shrunk_count, 10.0f);
+        TEST_CHECK(CheckAgainstLinearSums(clipper, heights));
+        clipper.End();
+        ImGui::End();
+        ImGui::Render();
+    }
+    return true;
+}
+
+// Items of random heights in a scrolled window: after a frame measuring them, the displayed items are exactly those overlapping the visible area
+static bool CheckDisplayedItems()
+{
+    const int count = 5000;
+    const float spacing = ImGui::GetStyle().ItemSpacing.y;
+    std::vector<float> heights(count);
+    for (int n = 0; n < count; n++)
+        heights[n] = spacing + RandomHeight();
+    const float window_height = 300.0f;
+    ImGuiVariableListClipper clipper;
+    for (int frame = 0; frame < 40; frame++)
+    {
+        const float scroll_y = (float)(TestRand() % 100000);
+        std::vector<int> displayed;
+        float list_start_y = 0.0f, content_end_y = 0.0f;
+        ImRect clip_rect;
+        for (int pass = 0; pass < 3; pass++)
+        {
+            displayed.clear();
+            ImGui::NewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+            ImGui::SetNextWindowSize(ImVec2(400.0f, window_height));
+            ImGui::Begin("List", NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoDecoration);
+            ImGui::SetScrollY(scroll_y);
+            list_start_y = ImGui::GetCursorScreenPos().y;
+            clip_rect = ImGui::GetCurrentWindow()->ClipRect;
+            clipper.Begin(count);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    ImGui::Dummy(ImVec2(100.0f, heights[i] - spacing));
+                    displayed.push_back(i);
+                }
+            content_end_y = ImGui::GetCursorScreenPos().y;
+            ImGui::End();
+            ImGui::Render();
+        }
+
+        // Heights of displayed items are measured, the list always spans the sum of all heights
+        for (int n = 0; n < (int)displayed.size(); n++)
+            TEST_CHECK(clipper.ItemsHeight[displayed[n]] == heights[displayed[n]]);
+        TEST_CHECK(content_end_y - list_start_y == clipper.GetItemOffset(count));
+
+        // Displayed items are consecutive, from the one at the top of the clipping rectangle down to the one crossing its bottom
+        TEST_CHECK(!displayed.empty());
+        for (int n = 1; n < (int)displayed.size(); n++)
+            TEST_CHECK(displayed[n] == displayed[n - 1] + 1);
+        const float visible_min = clip_rect.Min.y - list_start_y, visible_max = clip_rect.Max.y - list_start_y;
+        const int first = displayed.front(), last = displayed.back();
+        TEST_CHECK(clipper.GetItemOffset(first) <= ImMax(visible_min, 0.0f) && (first == count - 1 || clipper.GetItemOffset(first + 1) > visible_min));
+        TEST_CHECK(last == count - 1 || clipper.GetItemOffset(last + 1) >= visible_max);
+        TEST_CHECK(clipper.GetItemOffset(last) < visible_max);
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    printf("ImGuiVariableListClipper\n");
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    bool ok = CheckPrefixSums() && CheckDisplayedItems();
+    if (ok)
+        printf("OK\n");
+
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+// Worker contexts merged into their parent: draw order of windows, popups and tooltips. Workers run on the main thread here.
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_internal.h"
+#include "test_common.h"
+
+// Index of the draw list of a window in the draw data of the current context, -1 when not drawn
+static int FindDrawList(const ImGuiWindow* window)
+{
+    const ImDrawData* draw_data = &ImGui::GetCurrentContext()->DrawData;
+    for (int n = 0; window != NULL && n < draw_data->CmdListsCount; n++)
+        if (draw_data->CmdLists[n] == window->DrawList)
+            return n;
+    return -1;
+}
+
+static ImGuiWindow* FindWindow(ImGuiContext* ctx, const char* name)
+{
+    for (int n = 0; n < ctx->Windows.Size; n++)
+        if (strcmp(ctx->Windows[n]->Name, name) == 0)
+            return ctx->Windows[n];
+    return NULL;
+}
+
+static ImGuiWindow* FindPopup(ImGuiContext* ctx)
+{
+    for (int n = 0; n < ctx->Windows.Size; n++)
+        if ((ctx->Windows[n]->Flags & ImGuiWindowFlags_Popup) && !(ctx->Windows[n]->Flags & ImGuiWindowFlags_Tooltip) && ctx->Windows[n]->Active)
+            return ctx->Windows[n];
+    return NULL;
+}
+
+// Worker window with a tooltip and a popup, below a parent window with a tooltip
+static void DrawWorkerFrame(ImGuiContext* worker, const char* name, float x, bool open_popup)
+{
+    ImGui::NewWorkerFrame(worker);
+    ImGui::SetNextWindowPos(ImVec2(x, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(200.0f, 200.0f));
+    ImGui::Begin(name);
+    ImGui::BeginTooltip();
+    ImGui::Text("%s tooltip", name);
+    ImGui::EndTooltip();
+    if (open_popup)
+        ImGui::OpenPopup("popup");
+    if (ImGui::BeginPopup("popup"))
+    {
+        ImGui::Text("%s popup", name);
+        ImGui::EndPopup();
+    }
+    ImGui::End();
+    ImGui::EndWorkerFrame();
+}
+
+static bool CheckDrawOrder(ImGuiContext* parent, ImGuiContext* worker_a, ImGuiContext* worker_b)
+{
+    for (int frame = 0; frame < 3; frame++)
+    {
+        ImGui::SetCurrentContext(parent);
+        ImGui::NewFrame();
+        DrawWorkerFrame(worker_a, "A", 0.0f, frame == 0);
+        DrawWorkerFrame(worker_b, "B", 300.0f, frame == 0);
+        ImGui::SetCurrentContext(parent);
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 100.0f));
+        ImGui::SetNextWindowSize(ImVec2(600.0f, 300.0f));
+        ImGui::Begin("Parent");
+        ImGui::SetTooltip("parent tooltip");
+        ImGui::End();
+        ImGui::MergeWorkerFrame(worker_a);
+        ImGui::MergeWorkerFrame(worker_b);
+        ImGui::Render();
+    }
+
+    const int window_a = FindDrawList(FindWindow(worker_a, "A"));
+    const int window_b = FindDrawList(FindWindow(worker_b, "B"));
+    const int window_parent = FindDrawList(FindWindow(parent, "Parent"));
+    const int tooltip_parent = FindDrawList(FindWindow(parent, "##Tooltip_00"));
+    const int tooltip_a = FindDrawList(FindWindow(worker_a, "##Tooltip_00"));
+    const int tooltip_b = FindDrawList(FindWindow(worker_b, "##Tooltip_00"));
+    const int popup_a = FindDrawList(FindPopup(worker_a));
+    const int popup_b = FindDrawList(FindPopup(worker_b));
+    TEST_CHECK(window_a >= 0 && window_b >= 0 && window_parent >= 0 && tooltip_parent >= 0 && tooltip_a >= 0 && tooltip_b >= 0);
+    TEST_CHECK(window_a < window_b && window_b < window_parent && window_parent < tooltip_parent);
+    TEST_CHECK(popup_a >= 0 && popup_b >= 0);
+    TEST_CHECK(tooltip_parent < popup_a && popup_a < tooltip_a && tooltip_a < popup_b && popup_b < tooltip_b);
+    return true;
+}
+
+int main(int, char**)
+{
+    printf("Worker contexts\n");
+    ImGuiContext* parent = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1000, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    io.MousePos = ImVec2(50.0f, 50.0f);
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGuiContext* worker_a = ImGui::CreateWorkerContext(parent);
+    ImGuiContext* worker_b = ImGui::CreateWorkerContext(parent);
+
+    bool ok = CheckDrawOrder(parent, worker_a, worker_b);
+    if (ok)
+        printf("OK\n");
+
+    ImGui::DestroyContext(worker_b);
+    ImGui::DestroyContext(worker_a);
+    ImGui::DestroyContext(parent);
+    return ok ? 0 : 1;
+}